@@ -0,0 +1,32 @@
+/*
+ * assets.h
+ *
+ *  Generated by frame_gen.py, do not edit
+ */
+
+#ifndef APP_DATA_ASSETS_H_
+#define APP_DATA_ASSETS_H_
+
+#include "image.h"
+
+// Alignment of the asset payloads in the .assets section
+#define ASSET_ALIGN 16
+
+#define FFRANK_WIDTH 40
+#define FFRANK_HEIGHT 40
+#define SMILEY_WIDTH 128
+#define SMILEY_HEIGHT 160
+
+// Index in the asset table
+enum ASSET_ID {
+	ASSET_FFRANK,
+	ASSET_SMILEY,
+	ASSET_COUNT,
+};
+
+extern const struct IMG_Image ffrank_asset;
+extern const struct IMG_Image smiley_asset;
+
+const struct IMG_Image* ASSET_Get(const enum ASSET_ID id);
+
+#endif /* APP_DATA_ASSETS_H_ */
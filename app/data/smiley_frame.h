@@ -1,171 +0,0 @@
-#ifndef SMILEY_FRAME_H
-#define SMILEY_FRAME_H
-
-#define SMILEY_WIDTH 128
-#define SMILEY_HEIGHT 160
-
-typedef unsigned char uint8_t;
-
-static const uint8_t smiley_buffer[SMILEY_WIDTH * SMILEY_HEIGHT * 3] = {
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x02, 0x02, 0x00,   0x03, 0x02, 0x00,   0x03, 0x02, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x03, 0x02, 0x00,   0x03, 0x02, 0x00,   0x02, 0x02, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x02, 0x02, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x0a, 0x08, 0x01,   0x0e, 0x0d, 0x02,   0x12, 0x0f, 0x02,   0x12, 0x0f, 0x02,   0x0e, 0x0d, 0x02,   0x0a, 0x08, 0x01,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x02, 0x02, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x03, 0x02, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1b, 0x18, 0x04,   0x40, 0x38, 0x0a,   0x69, 0x5c, 0x12,   0x8c, 0x7b, 0x18,   0xaa, 0x96, 0x1e,   0xc1, 0xa9, 0x22,   0xd0, 0xb7, 0x24,   0xdc, 0xc2, 0x26,   0xe5, 0xc9, 0x28,   0xe7, 0xcb, 0x28,   0xe7, 0xcb, 0x28,   0xe5, 0xc9, 0x28,   0xdc, 0xc2, 0x26,   0xd0, 0xb7, 0x24,   0xc0, 0xa9, 0x22,   0xaa, 0x96, 0x1e,   0x8c, 0x7a, 0x18,   0x68, 0x5c, 0x12,   0x40, 0x38, 0x0a,   0x1b, 0x17, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1d, 0x19, 0x04,   0x55, 0x4c, 0x0e,   0x96, 0x83, 0x1a,   0xca, 0xb1, 0x23,   0xed, 0xd0, 0x29,   0xfc, 0xe1, 0x2d,   0xfc, 0xe7, 0x2e,   0xfc, 0xe7, 0x2e,   0xfc, 0xe5, 0x2e,   0xfc, 0xe2, 0x2d,   0xfc, 0xdf, 0x2c,   0xfc, 0xdd, 0x2c,   0xfa, 0xdc, 0x2c,   0xfa, 0xdb, 0x2c,   0xfa, 0xdb, 0x2c,   0xfa, 0xdc, 0x2c,   0xfc, 0xdd, 0x2c,   0xfc, 0xdf, 0x2c,   0xfc, 0xe2, 0x2d,   0xfc, 0xe5, 0x2e,   0xfc, 0xe7, 0x2e,   0xfc, 0xe7, 0x2e,   0xfc, 0xe1, 0x2d,   0xec, 0xd0, 0x29,   0xc9, 0xb1, 0x23,   0x95, 0x83, 0x1a,   0x58, 0x4e, 0x0f,   0x1d, 0x1a, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1e, 0x1a, 0x04,   0x67, 0x5b, 0x12,   0xb4, 0xa1, 0x20,   0xec, 0xd0, 0x29,   0xfc, 0xe5, 0x2e,   0xfc, 0xe6, 0x2e,   0xfc, 0xe1, 0x2d,   0xf9, 0xda, 0x2b,   0xf4, 0xd6, 0x2b,   0xf2, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf3, 0xd6, 0x2b,   0xf4, 0xd6, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf9, 0xda, 0x2b,   0xfc, 0xe1, 0x2d,   0xfc, 0xe7, 0x2e,   0xfc, 0xe5, 0x2e,   0xed, 0xd1, 0x29,   0xb6, 0xa2, 0x20,   0x69, 0x5d, 0x12,   0x1e, 0x1b, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x49, 0x41, 0x0c,   0xa8, 0x94, 0x1d,   0xeb, 0xd0, 0x2a,   0xfc, 0xe7, 0x2e,   0xfc, 0xe3, 0x2d,   0xf9, 0xda, 0x2b,   0xf3, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf4, 0xd6, 0x2b,   0xf2, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf8, 0xda, 0x2b,   0xfc, 0xe3, 0x2d,   0xfc, 0xe7, 0x2e,   0xec, 0xd1, 0x2a,   0xa8, 0x95, 0x1d,   0x49, 0x41, 0x0c,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x09, 0x08, 0x01,   0x62, 0x57, 0x11,   0xc7, 0xb1, 0x23,   0xfc, 0xe2, 0x2d,   0xfc, 0xe5, 0x2e,   0xf8, 0xda, 0x2b,   0xf2, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf3, 0xd6, 0x2a,   0xf2, 0xd5, 0x2a,   0xf8, 0xda, 0x2b,   0xfc, 0xe5, 0x2e,   0xfc, 0xe2, 0x2d,   0xc9, 0xb2, 0x23,   0x62, 0x57, 0x11,   0x0a, 0x09, 0x01,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x04, 0x04, 0x00,   0x64, 0x59, 0x11,   0xd3, 0xbc, 0x25,   0xfc, 0xe6, 0x2e,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf3, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xfc, 0xe0, 0x2d,   0xfc, 0xe6, 0x2e,   0xd4, 0xbc, 0x25,   0x66, 0x5a, 0x11,   0x06, 0x05, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x4f, 0x46, 0x0d,   0xca, 0xb4, 0x24,   0xfc, 0xe6, 0x2e,   0xfc, 0xdf, 0x2c,   0xf3, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xdf, 0x2c,   0xfc, 0xe6, 0x2e,   0xcc, 0xb5, 0x24,   0x50, 0x46, 0x0d,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x26, 0x21, 0x06,   0xaa, 0x99, 0x1e,   0xfc, 0xe3, 0x2d,   0xfc, 0xe0, 0x2d,   0xf2, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe0, 0x2d,   0xfc, 0xe3, 0x2d,   0xab, 0x99, 0x1e,   0x26, 0x21, 0x06,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x6c, 0x5f, 0x13,   0xed, 0xd2, 0x2a,   0xfc, 0xe5, 0x2e,   0xf3, 0xd6, 0x2b,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe5, 0x2e,   0xed, 0xd3, 0x2a,   0x6c, 0x5f, 0x13,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x1f, 0x1a, 0x04,   0xb1, 0x9f, 0x1f,   0xfc, 0xe7, 0x2e,   0xf8, 0xda, 0x2b,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf8, 0xda, 0x2b,   0xfc, 0xe7, 0x2e,   0xb3, 0xa0, 0x20,   0x1f, 0x1a, 0x04,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x4d, 0x44, 0x0d,   0xe3, 0xca, 0x28,   0xfc, 0xe5, 0x2e,   0xf2, 0xd4, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe5, 0x2e,   0xe4, 0xcb, 0x28,   0x4d, 0x43, 0x0d,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x7a, 0x6d, 0x15,   0xfc, 0xe1, 0x2d,   0xfa, 0xdd, 0x2c,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfa, 0xdd, 0x2c,   0xfc, 0xe1, 0x2d,   0x7c, 0x6d, 0x15,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x06, 0x05, 0x00,   0xa2, 0x8f, 0x1c,   0xfc, 0xe8, 0x2e,   0xf4, 0xd7, 0x2b,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf4, 0xd7, 0x2b,   0xfc, 0xe8, 0x2e,   0xa2, 0x90, 0x1c,   0x07, 0x05, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x14, 0x11, 0x03,   0xbd, 0xa8, 0x21,   0xfc, 0xe8, 0x2e,   0xf2, 0xd4, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0xbd, 0xa8, 0x21,   0x14, 0x10, 0x02,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x1c, 0x18, 0x04,   0xce, 0xb8, 0x24,   0xfc, 0xe5, 0x2e,   0xf1, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf1, 0xd3, 0x2a,   0xfc, 0xe5, 0x2e,   0xce, 0xb7, 0x24,   0x1c, 0x18, 0x04,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x20, 0x1c, 0x05,   0xd7, 0xbf, 0x26,   0xfc, 0xe3, 0x2d,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe4, 0x2d,   0xd7, 0xbf, 0x26,   0x21, 0x1c, 0x05,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x1e, 0x1a, 0x04,   0xd8, 0xc0, 0x26,   0xfc, 0xe3, 0x2d,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe2, 0x2d,   0xd9, 0xc1, 0x27,   0x1f, 0x1a, 0x05,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x17, 0x14, 0x03,   0xd3, 0xbb, 0x25,   0xfc, 0xe3, 0x2d,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe3, 0x2d,   0xd3, 0xbc, 0x26,   0x17, 0x14, 0x03,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x0c, 0x0b, 0x01,   0xc7, 0xb0, 0x23,   0xfc, 0xe4, 0x2d,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe4, 0x2d,   0xc7, 0xb0, 0x23,   0x0d, 0x0b, 0x01,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x01, 0x01, 0x00,   0xb0, 0x9c, 0x1f,   0xfc, 0xe7, 0x2e,   0xf1, 0xd3, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf1, 0xd4, 0x2a,   0xfc, 0xe7, 0x2e,   0xb0, 0x9d, 0x1f,   0x01, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x8f, 0x7d, 0x19,   0xfc, 0xe9, 0x2e,   0xf1, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe9, 0x2e,   0x90, 0x7e, 0x19,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x64, 0x57, 0x11,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x64, 0x57, 0x11,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x36, 0x2f, 0x09,   0xf5, 0xdb, 0x2c,   0xf5, 0xd9, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd9, 0x2b,   0xf5, 0xdb, 0x2c,   0x36, 0x2f, 0x09,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x0f, 0x0d, 0x02,   0xd7, 0xbf, 0x26,   0xfa, 0xe0, 0x2d,   0xf3, 0xd5, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd5, 0x2b,   0xfa, 0xe0, 0x2d,   0xd8, 0xbe, 0x26,   0x0f, 0x0d, 0x02,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0xa1, 0x8d, 0x1c,   0xfc, 0xe7, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe7, 0x2e,   0xa2, 0x8d, 0x1c,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x59, 0x4e, 0x0f,   0xfc, 0xe6, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x59, 0x4e, 0x0f,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x1a, 0x17, 0x04,   0xe7, 0xcd, 0x29,   0xf8, 0xdc, 0x2c,   0xf4, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd7, 0x2b,   0xf8, 0xdc, 0x2c,   0xe7, 0xcd, 0x29,   0x1a, 0x17, 0x04,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0xa8, 0x93, 0x1d,   0xfc, 0xe6, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0xa8, 0x93, 0x1d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x4e, 0x44, 0x0d,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe4, 0x2e,   0x4e, 0x44, 0x0d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x0a, 0x09, 0x01,   0xd8, 0xbd, 0x26,   0xfa, 0xdf, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfa, 0xdf, 0x2d,   0xd7, 0xbd, 0x26,   0x0a, 0x09, 0x01,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x7b, 0x6c, 0x15,   0xfc, 0xe8, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0x7b, 0x6b, 0x15,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x1c, 0x19, 0x04,   0xec, 0xd1, 0x2a,   0xf7, 0xda, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf7, 0xda, 0x2b,   0xec, 0xd1, 0x2a,   0x1c, 0x18, 0x04,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x97, 0x84, 0x1a,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x96, 0x83, 0x1a,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x28, 0x23, 0x06,   0xf3, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd8, 0x2b,   0x27, 0x22, 0x06,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x9e, 0x8b, 0x1c,   0xfc, 0xe6, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x9e, 0x8a, 0x1b,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x26, 0x22, 0x06,   0xf3, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd8, 0x2b,   0x26, 0x21, 0x06,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x95, 0x82, 0x1a,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x94, 0x82, 0x19,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x19, 0x16, 0x04,   0xec, 0xd0, 0x29,   0xf8, 0xda, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xda, 0x2b,   0xec, 0xd0, 0x29,   0x19, 0x16, 0x04,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x79, 0x6b, 0x15,   0xfc, 0xe8, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0x79, 0x6a, 0x14,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x08, 0x07, 0x00,   0xd8, 0xbd, 0x26,   0xfa, 0xde, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfa, 0xde, 0x2c,   0xd7, 0xbc, 0x26,   0x07, 0x06, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x50, 0x46, 0x0d,   0xfc, 0xe4, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe4, 0x2e,   0x4f, 0x45, 0x0d,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0xae, 0x99, 0x1e,   0xfc, 0xe4, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0xad, 0x99, 0x1e,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1f, 0x1b, 0x04,   0xf0, 0xd4, 0x2a,   0xf8, 0xd9, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf8, 0xd9, 0x2b,   0xf0, 0xd3, 0x2a,   0x1e, 0x1a, 0x04,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x6e, 0x61, 0x13,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf2, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x6e, 0x61, 0x13,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xbf, 0xa8, 0x22,   0xfc, 0xe2, 0x2d,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xfc, 0xe4, 0x2d,   0xfc, 0xe3, 0x2d,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd6, 0x2b,   0xf8, 0xda, 0x2b,   0xfc, 0xe7, 0x2e,   0xfc, 0xe7, 0x2e,   0xfb, 0xdc, 0x2c,   0xf5, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe2, 0x2d,   0xbf, 0xa8, 0x22,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x25, 0x21, 0x06,   0xf4, 0xd8, 0x2b,   0xf7, 0xd9, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd6, 0x2b,   0xf9, 0xdc, 0x2c,   0xf8, 0xda, 0x2b,   0xad, 0x99, 0x1e,   0xb5, 0xa0, 0x20,   0xfc, 0xdf, 0x2c,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd6, 0x2b,   0xfa, 0xdd, 0x2c,   0xf0, 0xd3, 0x2a,   0x86, 0x76, 0x17,   0x76, 0x68, 0x14,   0xe2, 0xc6, 0x28,   0xfb, 0xde, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf7, 0xd9, 0x2b,   0xf4, 0xd7, 0x2b,   0x25, 0x21, 0x06,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x6e, 0x60, 0x13,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xdb, 0x2c,   0xed, 0xd4, 0x2a,   0x46, 0x3e, 0x0c,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x76, 0x68, 0x14,   0xfc, 0xe3, 0x2d,   0xf4, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf7, 0xdb, 0x2c,   0xec, 0xd2, 0x2a,   0x38, 0x31, 0x09,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x2a, 0x25, 0x07,   0xec, 0xd2, 0x2a,   0xf7, 0xda, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x6d, 0x60, 0x13,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0xb6, 0xa1, 0x20,   0xfc, 0xe3, 0x2d,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2a,   0xfc, 0xe3, 0x2d,   0x54, 0x4b, 0x0e,   0x00, 0x00, 0x00,   0x05, 0x04, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0xc3, 0xab, 0x22,   0xfb, 0xe1, 0x2d,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2a,   0xfc, 0xe4, 0x2d,   0x58, 0x4e, 0x0f,   0x00, 0x00, 0x00,   0x06, 0x05, 0x00,   0x07, 0x05, 0x00,   0x00, 0x00, 0x00,   0x83, 0x72, 0x16,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe3, 0x2d,   0xb5, 0xa0, 0x20,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x16, 0x14, 0x03,   0xeb, 0xce, 0x29,   0xf9, 0xdb, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe4, 0x2d,   0xae, 0x99, 0x1e,   0x00, 0x00, 0x00,   0x04, 0x03, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x61, 0x55, 0x10,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe3, 0x2d,   0xb9, 0xa3, 0x20,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x01, 0x00, 0x00,   0x2a, 0x25, 0x06,   0xf6, 0xda, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf9, 0xdb, 0x2c,   0xeb, 0xce, 0x29,   0x16, 0x14, 0x03,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x51, 0x47, 0x0e,   0xfc, 0xe4, 0x2d,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xde, 0x2c,   0x35, 0x2f, 0x09,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x24, 0x1f, 0x06,   0xf3, 0xd6, 0x2b,   0xf7, 0xd9, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2a,   0xfc, 0xe2, 0x2d,   0x46, 0x3e, 0x0c,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0xd2, 0xb8, 0x24,   0xfc, 0xdf, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe4, 0x2d,   0x50, 0x46, 0x0d,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x90, 0x7f, 0x19,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe2, 0x2d,   0xbf, 0xa8, 0x21,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x05, 0x04, 0x00,   0xd6, 0xbc, 0x25,   0xfc, 0xde, 0x2c,   0xf4, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe0, 0x2d,   0xd2, 0xb7, 0x25,   0x04, 0x03, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0xaa, 0x96, 0x1d,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x90, 0x7e, 0x19,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xc8, 0xb0, 0x23,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x6b, 0x5e, 0x12,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0xba, 0xa5, 0x20,   0xfc, 0xe3, 0x2d,   0xf3, 0xd5, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x85, 0x75, 0x17,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x8d, 0x7c, 0x18,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe1, 0x2d,   0xc8, 0xb0, 0x23,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1d, 0x1a, 0x04,   0xf0, 0xd2, 0x2a,   0xf8, 0xda, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0x27, 0x23, 0x06,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0xa7, 0x93, 0x1d,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfb, 0xe1, 0x2d,   0x40, 0x38, 0x0b,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x7a, 0x6b, 0x15,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xda, 0x2c,   0xef, 0xd2, 0x2a,   0x1d, 0x19, 0x04,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x4d, 0x44, 0x0d,   0xfc, 0xe4, 0x2e,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe0, 0x2d,   0xd0, 0xb7, 0x24,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x9d, 0x8a, 0x1b,   0xfc, 0xe6, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xfa, 0xdc, 0x2c,   0xe5, 0xc9, 0x28,   0x10, 0x0e, 0x02,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x71, 0x63, 0x13,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe4, 0x2d,   0x4c, 0x43, 0x0d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x80, 0x71, 0x16,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0xa2, 0x8f, 0x1c,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x9c, 0x89, 0x1b,   0xfc, 0xe6, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe2, 0x2d,   0xbf, 0xa8, 0x21,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x72, 0x64, 0x13,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x80, 0x70, 0x16,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0xb0, 0x9b, 0x1f,   0xfc, 0xe4, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x77, 0x68, 0x14,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0xa4, 0x90, 0x1c,   0xfc, 0xe6, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x99, 0x86, 0x1a,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x7c, 0x6d, 0x15,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe4, 0x2e,   0xaf, 0x9b, 0x1e,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x06, 0x05, 0x00,   0xd7, 0xbd, 0x26,   0xfc, 0xde, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0x54, 0x4a, 0x0e,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0xb3, 0x9e, 0x1f,   0xfc, 0xe4, 0x2d,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x77, 0x68, 0x14,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x8f, 0x7e, 0x18,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xde, 0x2c,   0xd6, 0xbc, 0x26,   0x05, 0x04, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x21, 0x1c, 0x05,   0xf1, 0xd4, 0x2a,   0xf8, 0xd9, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe0, 0x2c,   0x3a, 0x33, 0x09,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xc8, 0xb0, 0x23,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x5d, 0x52, 0x10,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0xa8, 0x95, 0x1d,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xd9, 0x2b,   0xf1, 0xd4, 0x2a,   0x20, 0x1c, 0x05,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x43, 0x3b, 0x0b,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf7, 0xd9, 0x2b,   0x2a, 0x25, 0x07,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x0d, 0x0b, 0x01,   0xe1, 0xc5, 0x27,   0xfb, 0xdd, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe3, 0x2d,   0x4d, 0x44, 0x0d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xc8, 0xaf, 0x23,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe1, 0x2d,   0x42, 0x3a, 0x0b,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x66, 0x5a, 0x12,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xd9, 0x2b,   0xf2, 0xd5, 0x2a,   0x22, 0x1e, 0x05,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x2a, 0x25, 0x07,   0xf7, 0xd9, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe1, 0x2d,   0x45, 0x3d, 0x0b,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x12, 0x10, 0x02,   0xe7, 0xca, 0x28,   0xfa, 0xdc, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x66, 0x59, 0x11,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x8a, 0x79, 0x18,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xd9, 0x2b,   0xf1, 0xd4, 0x2a,   0x21, 0x1d, 0x05,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x56, 0x4d, 0x0e,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe2, 0x2d,   0x46, 0x3d, 0x0b,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x3b, 0x34, 0x09,   0xfb, 0xdf, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x89, 0x79, 0x18,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0xa9, 0x95, 0x1d,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf7, 0xd9, 0x2b,   0xf5, 0xd7, 0x2b,   0x27, 0x22, 0x06,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x92, 0x80, 0x19,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe4, 0x2d,   0x4f, 0x45, 0x0d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x76, 0x68, 0x14,   0xfc, 0xe8, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0xa8, 0x94, 0x1d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xc3, 0xab, 0x22,   0xfc, 0xe2, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xfc, 0xde, 0x2c,   0x36, 0x2f, 0x09,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x04, 0x03, 0x00,   0xd2, 0xb7, 0x24,   0xfc, 0xdf, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x62, 0x56, 0x11,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0xbd, 0xa6, 0x21,   0xfc, 0xe3, 0x2d,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe2, 0x2d,   0xc3, 0xab, 0x22,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x06, 0x05, 0x00,   0xd8, 0xbe, 0x26,   0xfc, 0xde, 0x2c,   0xf4, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2b,   0xfc, 0xe4, 0x2e,   0x52, 0x47, 0x0e,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x3a, 0x32, 0x09,   0xfa, 0xdf, 0x2d,   0xf5, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x84, 0x74, 0x17,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x26, 0x21, 0x06,   0xf4, 0xd8, 0x2b,   0xf7, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd7, 0x2b,   0xfc, 0xde, 0x2c,   0xd7, 0xbd, 0x26,   0x06, 0x05, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x13, 0x11, 0x03,   0xe8, 0xcc, 0x29,   0xfa, 0xdb, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe8, 0x2e,   0x7c, 0x6d, 0x15,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x99, 0x86, 0x1a,   0xfc, 0xe6, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2b,   0xfc, 0xe4, 0x2e,   0xb2, 0x9d, 0x1f,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x86, 0x75, 0x17,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xfa, 0xdb, 0x2c,   0xe7, 0xcb, 0x29,   0x13, 0x11, 0x03,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x24, 0x1f, 0x05,   0xf3, 0xd5, 0x2a,   0xf7, 0xd9, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe3, 0x2d,   0xba, 0xa4, 0x20,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x1f, 0x1c, 0x05,   0xef, 0xd4, 0x2a,   0xf7, 0xd9, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf9, 0xdb, 0x2c,   0xe7, 0xcb, 0x28,   0x11, 0x0f, 0x03,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x01, 0x00, 0x00,   0x16, 0x14, 0x03,   0xe8, 0xce, 0x29,   0xf8, 0xdb, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf7, 0xd9, 0x2b,   0xf2, 0xd5, 0x2a,   0x23, 0x1f, 0x05,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x32, 0x2c, 0x08,   0xfb, 0xdd, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf7, 0xd8, 0x2b,   0xf4, 0xd8, 0x2b,   0x26, 0x20, 0x06,   0x00, 0x00, 0x00,   0x06, 0x05, 0x00,   0x04, 0x03, 0x00,   0x00, 0x00, 0x00,   0xa7, 0x93, 0x1d,   0xfc, 0xe5, 0x2d,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x67, 0x59, 0x12,   0x00, 0x00, 0x00,   0x06, 0x06, 0x01,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0xa1, 0x8e, 0x1c,   0xfc, 0xe5, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xfb, 0xdc, 0x2c,   0x31, 0x2b, 0x08,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x40, 0x38, 0x0b,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe4, 0x2d,   0xaa, 0x97, 0x1e,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x72, 0x64, 0x13,   0xfc, 0xe4, 0x2d,   0xf4, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd7, 0x2b,   0xf8, 0xdc, 0x2c,   0xe3, 0xc9, 0x28,   0x26, 0x21, 0x06,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x7c, 0x6d, 0x15,   0xfc, 0xe4, 0x2e,   0xf4, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe0, 0x2d,   0x3f, 0x37, 0x0b,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x4c, 0x43, 0x0d,   0xfc, 0xe3, 0x2d,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe2, 0x2d,   0xa9, 0x96, 0x1d,   0x60, 0x54, 0x10,   0xa0, 0x8c, 0x1c,   0xfc, 0xe1, 0x2d,   0xf5, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd6, 0x2b,   0xfb, 0xdf, 0x2c,   0xe4, 0xc8, 0x28,   0x98, 0x85, 0x1a,   0xbc, 0xa6, 0x21,   0xfc, 0xe3, 0x2d,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe3, 0x2d,   0x4c, 0x43, 0x0d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x55, 0x4c, 0x0e,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe3, 0x2d,   0xfc, 0xe6, 0x2e,   0xfc, 0xe4, 0x2d,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd6, 0x2b,   0xfa, 0xdb, 0x2c,   0xfc, 0xe6, 0x2e,   0xfc, 0xe2, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0x55, 0x4b, 0x0e,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x5d, 0x52, 0x10,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf2, 0xd5, 0x2a,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x5c, 0x52, 0x0f,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x62, 0x55, 0x11,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x61, 0x56, 0x11,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x64, 0x58, 0x11,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x64, 0x58, 0x11,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x64, 0x58, 0x11,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x64, 0x58, 0x11,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x62, 0x55, 0x11,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x61, 0x55, 0x11,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x5d, 0x52, 0x10,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x5c, 0x52, 0x0f,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x55, 0x4c, 0x0e,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0x55, 0x4b, 0x0e,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x4c, 0x43, 0x0d,   0xfc, 0xe3, 0x2d,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe3, 0x2d,   0x4c, 0x42, 0x0d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x40, 0x38, 0x0b,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe0, 0x2d,   0x3f, 0x37, 0x0b,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x32, 0x2b, 0x08,   0xfb, 0xdd, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfa, 0xdc, 0x2c,   0xf8, 0xda, 0x2b,   0xf6, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf7, 0xd9, 0x2b,   0xfc, 0xe4, 0x2d,   0xf6, 0xd8, 0x2b,   0xf6, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xfb, 0xdc, 0x2c,   0x31, 0x2b, 0x08,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x24, 0x1f, 0x05,   0xf3, 0xd5, 0x2a,   0xf7, 0xd9, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe0, 0x2d,   0xe4, 0xc8, 0x28,   0xec, 0xcf, 0x29,   0xf8, 0xda, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf8, 0xda, 0x2b,   0xef, 0xd2, 0x2a,   0xa8, 0x94, 0x1d,   0xf4, 0xd7, 0x2b,   0xf7, 0xda, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf7, 0xd9, 0x2b,   0xf2, 0xd5, 0x2a,   0x23, 0x1f, 0x05,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x13, 0x11, 0x03,   0xe8, 0xcc, 0x29,   0xfa, 0xdb, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2a,   0xfb, 0xe1, 0x2d,   0xcc, 0xb5, 0x24,   0x17, 0x14, 0x03,   0x8c, 0x7a, 0x18,   0xfc, 0xe8, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe3, 0x2d,   0xbc, 0xa6, 0x21,   0x00, 0x00, 0x00,   0x6d, 0x60, 0x13,   0xfc, 0xe5, 0x2d,   0xf4, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xfa, 0xdb, 0x2c,   0xe7, 0xcb, 0x29,   0x13, 0x11, 0x03,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x06, 0x05, 0x00,   0xd8, 0xbe, 0x26,   0xfc, 0xde, 0x2c,   0xf4, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd9, 0x2b,   0xf1, 0xd6, 0x2b,   0x2a, 0x25, 0x07,   0x00, 0x00, 0x00,   0x56, 0x4d, 0x0f,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x8b, 0x7a, 0x18,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0xbf, 0xa8, 0x21,   0xfb, 0xe2, 0x2d,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd7, 0x2b,   0xfc, 0xde, 0x2c,   0xd7, 0xbd, 0x26,   0x06, 0x05, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xc3, 0xab, 0x22,   0xfc, 0xe2, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0x86, 0x75, 0x17,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x39, 0x32, 0x09,   0xfc, 0xdf, 0x2d,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x6e, 0x60, 0x13,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x43, 0x3a, 0x0b,   0xfb, 0xe1, 0x2d,   0xf4, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe2, 0x2d,   0xc2, 0xab, 0x22,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0xa9, 0x95, 0x1d,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xdb, 0x2c,   0xe8, 0xcd, 0x29,   0x15, 0x12, 0x03,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x28, 0x23, 0x06,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x5d, 0x52, 0x10,   0x00, 0x00, 0x00,   0x04, 0x03, 0x00,   0x00, 0x00, 0x00,   0xc2, 0xaa, 0x22,   0xfb, 0xe2, 0x2d,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0xa8, 0x94, 0x1d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x8a, 0x79, 0x18,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe8, 0x2e,   0x88, 0x77, 0x18,   0x00, 0x00, 0x00,   0x04, 0x04, 0x00,   0x00, 0x00, 0x00,   0x1f, 0x1c, 0x05,   0xf0, 0xd2, 0x2a,   0xf8, 0xda, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0x55, 0x4b, 0x0e,   0x00, 0x00, 0x00,   0x07, 0x06, 0x00,   0x00, 0x00, 0x00,   0x5b, 0x51, 0x10,   0xfc, 0xe6, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x89, 0x78, 0x18,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x66, 0x5a, 0x12,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xda, 0x2b,   0xef, 0xd4, 0x2a,   0x1e, 0x1a, 0x05,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x1b, 0x18, 0x04,   0xed, 0xd0, 0x29,   0xf9, 0xda, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0x54, 0x4a, 0x0e,   0x00, 0x00, 0x00,   0x04, 0x03, 0x00,   0x00, 0x00, 0x00,   0x0d, 0x0b, 0x01,   0xe0, 0xc5, 0x27,   0xfa, 0xdd, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x65, 0x59, 0x11,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x42, 0x3a, 0x0b,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0x96, 0x84, 0x1a,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x0a, 0x09, 0x01,   0xdd, 0xc3, 0x27,   0xfb, 0xdd, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x5d, 0x53, 0x10,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x8d, 0x7c, 0x18,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe1, 0x2d,   0x42, 0x3a, 0x0b,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x20, 0x1c, 0x05,   0xf2, 0xd4, 0x2a,   0xf8, 0xd9, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe8, 0x2e,   0x64, 0x58, 0x11,   0x00, 0x00, 0x00,   0x06, 0x05, 0x01,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0xad, 0x98, 0x1e,   0xfb, 0xe5, 0x2d,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x60, 0x54, 0x10,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x30, 0x2a, 0x08,   0xf9, 0xdd, 0x2c,   0xf6, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xd9, 0x2b,   0xf1, 0xd4, 0x2a,   0x20, 0x1c, 0x05,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x06, 0x05, 0x00,   0xd7, 0xbd, 0x26,   0xfc, 0xde, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd7, 0x2b,   0xfa, 0xdf, 0x2c,   0xcb, 0xb4, 0x24,   0x0e, 0x0c, 0x02,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x07, 0x05, 0x00,   0x00, 0x00, 0x00,   0x5b, 0x50, 0x10,   0xfc, 0xe7, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd7, 0x2b,   0xf9, 0xdc, 0x2c,   0x32, 0x2c, 0x08,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xbf, 0xa8, 0x21,   0xfc, 0xe2, 0x2d,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xde, 0x2c,   0xd6, 0xbc, 0x26,   0x05, 0x04, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0xb0, 0x9b, 0x1f,   0xfc, 0xe4, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe2, 0x2d,   0xcc, 0xb4, 0x24,   0x41, 0x39, 0x0b,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x08, 0x07, 0x01,   0xd3, 0xb8, 0x25,   0xfa, 0xdf, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfb, 0xe0, 0x2c,   0xcc, 0xb3, 0x24,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x04, 0x03, 0x00,   0x00, 0x00, 0x00,   0x87, 0x76, 0x17,   0xfc, 0xe8, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe4, 0x2e,   0xaf, 0x9a, 0x1e,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x80, 0x71, 0x16,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2a,   0xfc, 0xe0, 0x2d,   0xfc, 0xde, 0x2c,   0xba, 0xa6, 0x21,   0x64, 0x57, 0x11,   0x04, 0x04, 0x00,   0x00, 0x00, 0x00,   0x54, 0x4a, 0x0e,   0xfc, 0xe6, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x74, 0x66, 0x14,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0xb8, 0xa2, 0x20,   0xfc, 0xe3, 0x2d,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x7f, 0x70, 0x16,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x4d, 0x44, 0x0d,   0xfc, 0xe4, 0x2e,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf5, 0xd7, 0x2b,   0xfc, 0xe1, 0x2d,   0xfc, 0xf0, 0x30,   0x5d, 0x52, 0x10,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0xbc, 0xa6, 0x21,   0xfc, 0xe3, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xda, 0x2b,   0xed, 0xd0, 0x29,   0x18, 0x15, 0x04,   0x00, 0x00, 0x00,   0x03, 0x03, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x71, 0x64, 0x13,   0xfc, 0xe2, 0x2d,   0xf4, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe3, 0x2d,   0x4c, 0x43, 0x0d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1d, 0x19, 0x04,   0xef, 0xd2, 0x2a,   0xf8, 0xda, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf1, 0xd4, 0x2a,   0xf7, 0xdc, 0x2c,   0xda, 0xc0, 0x26,   0x0c, 0x0a, 0x02,   0x00, 0x00, 0x00,   0x33, 0x2d, 0x08,   0xf7, 0xdd, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x8e, 0x7d, 0x19,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x17, 0x14, 0x03,   0x95, 0x84, 0x1a,   0xfc, 0xe2, 0x2d,   0xf5, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xda, 0x2c,   0xef, 0xd2, 0x2a,   0x1d, 0x19, 0x04,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xc8, 0xb0, 0x23,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0x7c, 0x6c, 0x15,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x91, 0x7f, 0x19,   0xfc, 0xe8, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf7, 0xda, 0x2b,   0xec, 0xd0, 0x2a,   0x1b, 0x18, 0x04,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x35, 0x2f, 0x09,   0x88, 0x78, 0x18,   0xe5, 0xca, 0x28,   0xfc, 0xe6, 0x2e,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe1, 0x2d,   0xc8, 0xb0, 0x23,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x90, 0x7e, 0x19,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf7, 0xda, 0x2b,   0xf0, 0xd5, 0x2a,   0x23, 0x1f, 0x05,   0x01, 0x00, 0x00,   0x11, 0x0f, 0x02,   0xdf, 0xc4, 0x27,   0xf9, 0xdd, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0x7e, 0x6e, 0x16,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x9a, 0x87, 0x1a,   0xfc, 0xe6, 0x2e,   0xfc, 0xe5, 0x2d,   0xfa, 0xdc, 0x2c,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x8f, 0x7d, 0x18,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x50, 0x46, 0x0d,   0xfc, 0xe4, 0x2d,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0xab, 0x96, 0x1e,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x51, 0x46, 0x0d,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf9, 0xde, 0x2c,   0xdb, 0xc1, 0x26,   0x0f, 0x0d, 0x02,   0x00, 0x00, 0x00,   0x38, 0x31, 0x09,   0xfb, 0xe1, 0x2d,   0xf5, 0xd7, 0x2b,   0xf2, 0xd4, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe4, 0x2d,   0x50, 0x46, 0x0d,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x16, 0x13, 0x03,   0xeb, 0xce, 0x29,   0xf9, 0xdb, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0x52, 0x47, 0x0e,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xa0, 0x8c, 0x1c,   0xfc, 0xe7, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x54, 0x4b, 0x0e,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xb9, 0xa3, 0x20,   0xfc, 0xe3, 0x2d,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf9, 0xdb, 0x2c,   0xeb, 0xce, 0x29,   0x16, 0x13, 0x03,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0xb6, 0xa1, 0x20,   0xfc, 0xe3, 0x2d,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf8, 0xdd, 0x2c,   0xdf, 0xc5, 0x27,   0x12, 0x10, 0x02,   0x01, 0x01, 0x00,   0x11, 0x10, 0x03,   0xdd, 0xc3, 0x27,   0xf9, 0xde, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0xb1, 0x9c, 0x1f,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x54, 0x4b, 0x0e,   0xfc, 0xe5, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe4, 0x2d,   0xb5, 0xa0, 0x20,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x6e, 0x60, 0x13,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe7, 0x2e,   0x9e, 0x8a, 0x1b,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x42, 0x3a, 0x0b,   0xfb, 0xe1, 0x2d,   0xf4, 0xd7, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xda, 0x2b,   0xed, 0xd3, 0x2a,   0x21, 0x1d, 0x05,   0x01, 0x00, 0x00,   0x0d, 0x0b, 0x02,   0xdb, 0xc1, 0x26,   0xf9, 0xde, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x6d, 0x60, 0x13,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x25, 0x21, 0x06,   0xf4, 0xd7, 0x2b,   0xf7, 0xd9, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0x54, 0x4a, 0x0e,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x7d, 0x6d, 0x15,   0xfc, 0xe9, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0x64, 0x57, 0x11,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x8b, 0x7a, 0x18,   0xfc, 0xe7, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf7, 0xd9, 0x2b,   0xf4, 0xd7, 0x2b,   0x25, 0x20, 0x06,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xbf, 0xa8, 0x22,   0xfc, 0xe2, 0x2d,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd7, 0x2b,   0xf7, 0xdc, 0x2c,   0xe8, 0xce, 0x29,   0x1e, 0x1a, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0xb2, 0x9d, 0x1f,   0xfc, 0xe6, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe7, 0x2e,   0xa9, 0x95, 0x1d,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x3a, 0x33, 0x0a,   0xf8, 0xde, 0x2c,   0xf4, 0xd7, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe2, 0x2d,   0xbf, 0xa8, 0x22,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x6e, 0x61, 0x13,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe4, 0x2d,   0xbc, 0xa6, 0x21,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x12, 0x10, 0x03,   0xd7, 0xbf, 0x26,   0xfb, 0xe0, 0x2d,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2b,   0xfa, 0xdf, 0x2c,   0xdb, 0xc2, 0x27,   0x13, 0x10, 0x03,   0x01, 0x00, 0x00,   0x0a, 0x09, 0x01,   0xd2, 0xb9, 0x25,   0xfb, 0xe0, 0x2d,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x6d, 0x60, 0x13,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1e, 0x1a, 0x04,   0xf0, 0xd3, 0x2a,   0xf8, 0xd9, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0x88, 0x77, 0x17,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x2e, 0x28, 0x07,   0xee, 0xd4, 0x2a,   0xf7, 0xdc, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd9, 0x2b,   0xf6, 0xdc, 0x2c,   0x38, 0x31, 0x09,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x93, 0x81, 0x19,   0xfc, 0xe7, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf8, 0xda, 0x2c,   0xf0, 0xd3, 0x2a,   0x1e, 0x1a, 0x04,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0xad, 0x99, 0x1e,   0xfc, 0xe4, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfc, 0xe5, 0x2e,   0x59, 0x4e, 0x0f,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x49, 0x40, 0x0c,   0xf9, 0xdf, 0x2c,   0xf5, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x61, 0x54, 0x10,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x55, 0x4b, 0x0e,   0xfc, 0xe4, 0x2e,   0xf3, 0xd6, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe5, 0x2e,   0xad, 0x98, 0x1e,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x4f, 0x46, 0x0d,   0xfc, 0xe4, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xda, 0x2b,   0xf2, 0xd9, 0x2b,   0x36, 0x2f, 0x09,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x5e, 0x53, 0x10,   0xfc, 0xe4, 0x2e,   0xf4, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe9, 0x2f,   0x85, 0x74, 0x17,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x29, 0x24, 0x07,   0xed, 0xd4, 0x2a,   0xf7, 0xdb, 0x2c,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd5, 0x2a,   0xfc, 0xe4, 0x2e,   0x4f, 0x45, 0x0d,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x08, 0x06, 0x00,   0xd8, 0xbd, 0x26,   0xfa, 0xde, 0x2c,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd6, 0x2a,   0xfa, 0xde, 0x2c,   0xe1, 0xc8, 0x28,   0x1f, 0x1a, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x6c, 0x5e, 0x12,   0xfc, 0xe6, 0x2e,   0xf4, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf1, 0xd4, 0x2a,   0xfc, 0xe9, 0x2e,   0x9d, 0x89, 0x1b,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x0f, 0x0d, 0x02,   0xd1, 0xb9, 0x25,   0xfc, 0xe1, 0x2d,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfa, 0xde, 0x2c,   0xd7, 0xbc, 0x26,   0x07, 0x06, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x79, 0x6a, 0x15,   0xfc, 0xe8, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe2, 0x2d,   0xcf, 0xb8, 0x25,   0x12, 0x0f, 0x02,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x70, 0x62, 0x13,   0xfc, 0xe5, 0x2e,   0xf4, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf1, 0xd4, 0x2a,   0xfc, 0xe9, 0x2f,   0xa8, 0x94, 0x1e,   0x02, 0x01, 0x00,   0x02, 0x02, 0x00,   0x01, 0x00, 0x00,   0xb1, 0x9d, 0x1f,   0xfc, 0xe6, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0x78, 0x6a, 0x14,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x19, 0x16, 0x04,   0xec, 0xd0, 0x29,   0xf8, 0xda, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe5, 0x2d,   0xc2, 0xab, 0x22,   0x0c, 0x0b, 0x01,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x69, 0x5c, 0x12,   0xfc, 0xe3, 0x2d,   0xf7, 0xd9, 0x2b,   0xf4, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe9, 0x2e,   0xa8, 0x95, 0x1d,   0x04, 0x03, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x99, 0x86, 0x1a,   0xfc, 0xe8, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf8, 0xda, 0x2c,   0xeb, 0xd0, 0x29,   0x19, 0x16, 0x03,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x94, 0x82, 0x19,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe6, 0x2e,   0xbb, 0xa6, 0x21,   0x0b, 0x09, 0x01,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x58, 0x4e, 0x0f,   0xf6, 0xdb, 0x2c,   0xfb, 0xde, 0x2c,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe9, 0x2e,   0x9d, 0x8b, 0x1b,   0x01, 0x01, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x89, 0x78, 0x18,   0xfc, 0xe8, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x93, 0x81, 0x19,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x26, 0x22, 0x06,   0xf3, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe6, 0x2e,   0xbd, 0xa8, 0x21,   0x0f, 0x0c, 0x02,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x40, 0x38, 0x0b,   0xe2, 0xca, 0x28,   0xfc, 0xe4, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf7, 0xda, 0x2b,   0xfc, 0xe6, 0x2e,   0x85, 0x76, 0x17,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x83, 0x73, 0x17,   0xfc, 0xe7, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd7, 0x2b,   0x25, 0x21, 0x06,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x9d, 0x8a, 0x1b,   0xfc, 0xe6, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe5, 0x2d,   0xc7, 0xb0, 0x23,   0x1a, 0x16, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x21, 0x1c, 0x05,   0xbf, 0xaa, 0x22,   0xfc, 0xe8, 0x2e,   0xf4, 0xd6, 0x2a,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe1, 0x2d,   0xf3, 0xd8, 0x2b,   0x5f, 0x54, 0x10,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x8a, 0x7a, 0x18,   0xfc, 0xe8, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x9d, 0x8a, 0x1b,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x27, 0x23, 0x06,   0xf3, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe4, 0x2d,   0xd9, 0xc1, 0x26,   0x2e, 0x28, 0x07,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x04, 0x03, 0x00,   0x89, 0x79, 0x18,   0xfb, 0xe0, 0x2d,   0xfc, 0xe0, 0x2c,   0xf2, 0xd4, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf5, 0xd7, 0x2b,   0xfc, 0xe8, 0x2e,   0xce, 0xb7, 0x24,   0x32, 0x2c, 0x08,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x9d, 0x8a, 0x1b,   0xfc, 0xe8, 0x2e,   0xf3, 0xd5, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd8, 0x2b,   0x27, 0x22, 0x06,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x96, 0x83, 0x1a,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe0, 0x2c,   0xec, 0xd3, 0x2a,   0x51, 0x47, 0x0d,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x44, 0x3c, 0x0b,   0xd1, 0xba, 0x25,   0xfc, 0xe8, 0x2e,   0xf8, 0xda, 0x2b,   0xf2, 0xd4, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe2, 0x2d,   0xf9, 0xde, 0x2c,   0x8d, 0x7d, 0x19,   0x0b, 0x09, 0x01,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x16, 0x13, 0x03,   0xb7, 0xa4, 0x20,   0xfc, 0xe8, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x95, 0x83, 0x1a,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x1c, 0x18, 0x04,   0xec, 0xd1, 0x2a,   0xf7, 0xda, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf8, 0xdb, 0x2c,   0xfc, 0xe1, 0x2d,   0x84, 0x75, 0x17,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x0b, 0x09, 0x01,   0x7d, 0x6f, 0x16,   0xed, 0xd2, 0x2a,   0xfc, 0xe7, 0x2e,   0xf8, 0xd9, 0x2b,   0xf2, 0xd4, 0x2a,   0xf4, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xfc, 0xe0, 0x2d,   0xfc, 0xe5, 0x2e,   0xc0, 0xaa, 0x22,   0x3c, 0x35, 0x0a,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x3b, 0x34, 0x0a,   0xd9, 0xc1, 0x27,   0xfc, 0xe5, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf7, 0xda, 0x2c,   0xec, 0xd1, 0x2a,   0x1c, 0x18, 0x04,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x7a, 0x6b, 0x15,   0xfc, 0xe8, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd6, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe7, 0x2e,   0xbd, 0xa8, 0x21,   0x2d, 0x27, 0x07,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x22, 0x1e, 0x05,   0x93, 0x83, 0x1a,   0xee, 0xd3, 0x2a,   0xfc, 0xe7, 0x2e,   0xfc, 0xde, 0x2c,   0xf4, 0xd6, 0x2b,   0xf2, 0xd5, 0x2a,   0xf4, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf3, 0xd6, 0x2b,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xfc, 0xe3, 0x2d,   0xfc, 0xe4, 0x2d,   0xcb, 0xb4, 0x24,   0x59, 0x50, 0x0f,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x75, 0x68, 0x14,   0xf6, 0xdb, 0x2c,   0xfc, 0xdf, 0x2c,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0x7a, 0x6a, 0x15,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x0a, 0x09, 0x01,   0xd7, 0xbd, 0x26,   0xfa, 0xdf, 0x2d,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe3, 0x2d,   0xf0, 0xd5, 0x2a,   0x74, 0x67, 0x14,   0x07, 0x06, 0x01,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x22, 0x1e, 0x05,   0x84, 0x75, 0x17,   0xd9, 0xc0, 0x26,   0xfc, 0xe3, 0x2d,   0xfc, 0xe6, 0x2e,   0xfc, 0xde, 0x2c,   0xf5, 0xd7, 0x2b,   0xf2, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf4, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf4, 0xd7, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xf2, 0xd4, 0x2a,   0xf4, 0xd6, 0x2b,   0xf9, 0xda, 0x2b,   0xfc, 0xe2, 0x2d,   0xfc, 0xe7, 0x2e,   0xf4, 0xd8, 0x2b,   0xb6, 0xa2, 0x20,   0x52, 0x49, 0x0e,   0x04, 0x04, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x32, 0x2c, 0x08,   0xbd, 0xa8, 0x21,   0xfc, 0xe7, 0x2e,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xfa, 0xdf, 0x2d,   0xd7, 0xbc, 0x26,   0x0a, 0x08, 0x01,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x4d, 0x43, 0x0d,   0xfc, 0xe4, 0x2d,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf7, 0xd9, 0x2b,   0xfc, 0xe7, 0x2e,   0xcb, 0xb4, 0x24,   0x4d, 0x44, 0x0d,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x0b, 0x0a, 0x01,   0x4f, 0x46, 0x0d,   0x9f, 0x8c, 0x1c,   0xd9, 0xc0, 0x26,   0xfa, 0xdc, 0x2c,   0xfc, 0xe7, 0x2e,   0xfc, 0xe7, 0x2e,   0xfc, 0xe4, 0x2d,   0xfc, 0xe1, 0x2d,   0xfc, 0xde, 0x2c,   0xfc, 0xdd, 0x2c,   0xfb, 0xdd, 0x2c,   0xfc, 0xde, 0x2c,   0xfc, 0xe0, 0x2d,   0xfc, 0xe3, 0x2d,   0xfc, 0xe6, 0x2e,   0xfc, 0xe8, 0x2e,   0xfc, 0xe2, 0x2d,   0xed, 0xd0, 0x29,   0xbc, 0xa7, 0x21,   0x76, 0x69, 0x14,   0x2a, 0x25, 0x07,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x18, 0x15, 0x03,   0x8c, 0x7c, 0x18,   0xf4, 0xd9, 0x2c,   0xfc, 0xe3, 0x2d,   0xf2, 0xd4, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe4, 0x2e,   0x4d, 0x43, 0x0d,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0xa7, 0x92, 0x1d,   0xfc, 0xe6, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe0, 0x2d,   0xfc, 0xe2, 0x2d,   0xb8, 0xa4, 0x20,   0x47, 0x3f, 0x0c,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x0a, 0x09, 0x01,   0x34, 0x2e, 0x08,   0x65, 0x59, 0x11,   0x91, 0x80, 0x19,   0xb3, 0x9e, 0x1f,   0xc9, 0xb0, 0x23,   0xd7, 0xbd, 0x25,   0xdf, 0xc3, 0x27,   0xdf, 0xc4, 0x27,   0xda, 0xbf, 0x26,   0xce, 0xb5, 0x24,   0xbd, 0xa7, 0x21,   0xa2, 0x8e, 0x1c,   0x79, 0x6b, 0x15,   0x49, 0x40, 0x0c,   0x1c, 0x19, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1b, 0x18, 0x04,   0x7d, 0x6e, 0x16,   0xe5, 0xcb, 0x28,   0xfc, 0xe7, 0x2e,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0xa7, 0x92, 0x1d,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x1a, 0x17, 0x04,   0xe7, 0xcd, 0x29,   0xf8, 0xdc, 0x2c,   0xf4, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf4, 0xd6, 0x2b,   0xfc, 0xe3, 0x2d,   0xfc, 0xe2, 0x2d,   0xc3, 0xad, 0x23,   0x66, 0x5a, 0x12,   0x1a, 0x17, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x09, 0x08, 0x01,   0x0d, 0x0b, 0x01,   0x0d, 0x0c, 0x02,   0x0b, 0x09, 0x01,   0x04, 0x04, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x38, 0x32, 0x09,   0x92, 0x81, 0x19,   0xe7, 0xcd, 0x29,   0xfc, 0xe7, 0x2e,   0xfa, 0xdb, 0x2c,   0xf2, 0xd5, 0x2a,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd7, 0x2b,   0xf8, 0xdc, 0x2c,   0xe7, 0xcd, 0x29,   0x1a, 0x16, 0x04,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x58, 0x4e, 0x0f,   0xfc, 0xe6, 0x2e,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xfc, 0xe1, 0x2d,   0xfc, 0xe6, 0x2e,   0xe7, 0xcc, 0x29,   0xa4, 0x91, 0x1c,   0x5b, 0x51, 0x0f,   0x23, 0x1f, 0x05,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x11, 0x0f, 0x02,   0x3e, 0x37, 0x0a,   0x83, 0x74, 0x16,   0xc9, 0xb1, 0x23,   0xfb, 0xdd, 0x2c,   0xfc, 0xe6, 0x2e,   0xfa, 0xdb, 0x2c,   0xf2, 0xd5, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe6, 0x2e,   0x58, 0x4e, 0x0f,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0xa1, 0x8d, 0x1c,   0xfc, 0xe7, 0x2e,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf2, 0xd5, 0x2a,   0xfa, 0xdb, 0x2c,   0xfc, 0xe5, 0x2e,   0xfc, 0xe5, 0x2e,   0xf0, 0xd3, 0x2a,   0xcb, 0xb2, 0x23,   0xa0, 0x8c, 0x1c,   0x74, 0x66, 0x14,   0x54, 0x4a, 0x0e,   0x3d, 0x35, 0x0a,   0x30, 0x2a, 0x08,   0x29, 0x24, 0x06,   0x28, 0x23, 0x06,   0x2d, 0x27, 0x07,   0x38, 0x31, 0x09,   0x4a, 0x41, 0x0c,   0x68, 0x5b, 0x12,   0x8c, 0x7b, 0x18,   0xb7, 0xa2, 0x20,   0xe2, 0xc7, 0x28,   0xfc, 0xdf, 0x2c,   0xfc, 0xe7, 0x2e,   0xfc, 0xe1, 0x2d,   0xf5, 0xd7, 0x2b,   0xf2, 0xd5, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe7, 0x2e,   0xa1, 0x8c, 0x1c,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x0f, 0x0d, 0x02,   0xd7, 0xbe, 0x26,   0xfa, 0xe0, 0x2d,   0xf3, 0xd5, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf3, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf8, 0xd9, 0x2b,   0xfc, 0xe0, 0x2d,   0xfc, 0xe6, 0x2e,   0xfc, 0xe7, 0x2e,   0xfc, 0xe4, 0x2d,   0xfc, 0xe0, 0x2d,   0xf8, 0xda, 0x2b,   0xf4, 0xd7, 0x2b,   0xf3, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xfc, 0xde, 0x2c,   0xfc, 0xe3, 0x2d,   0xfc, 0xe6, 0x2e,   0xfc, 0xe7, 0x2e,   0xfc, 0xe3, 0x2d,   0xfb, 0xdc, 0x2c,   0xf4, 0xd7, 0x2b,   0xf2, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf3, 0xd5, 0x2b,   0xfb, 0xe0, 0x2d,   0xd7, 0xbe, 0x26,   0x0e, 0x0d, 0x02,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x35, 0x2e, 0x09,   0xf5, 0xdb, 0x2c,   0xf5, 0xd9, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf4, 0xd6, 0x2b,   0xf2, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf7, 0xd9, 0x2b,   0xf7, 0xd9, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf3, 0xd6, 0x2b,   0xf2, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf3, 0xd6, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd9, 0x2b,   0xf5, 0xdb, 0x2c,   0x35, 0x2f, 0x09,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x64, 0x56, 0x11,   0xfc, 0xe7, 0x2e,   0xf2, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xfc, 0xe7, 0x2e,   0x64, 0x57, 0x11,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x8f, 0x7d, 0x19,   0xfc, 0xe9, 0x2e,   0xf1, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf1, 0xd4, 0x2a,   0xfc, 0xe9, 0x2e,   0x8f, 0x7e, 0x19,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0xaf, 0x9b, 0x1f,   0xfc, 0xe7, 0x2e,   0xf1, 0xd3, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf1, 0xd4, 0x2a,   0xfc, 0xe7, 0x2e,   0xb0, 0x9c, 0x1f,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x0c, 0x0a, 0x01,   0xc6, 0xaf, 0x23,   0xfc, 0xe5, 0x2d,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe5, 0x2d,   0xc6, 0xaf, 0x23,   0x0c, 0x0a, 0x01,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x16, 0x13, 0x03,   0xd2, 0xbb, 0x25,   0xfc, 0xe3, 0x2d,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe3, 0x2d,   0xd3, 0xbb, 0x25,   0x16, 0x13, 0x03,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x1e, 0x1a, 0x04,   0xd8, 0xc0, 0x26,   0xfc, 0xe3, 0x2d,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe3, 0x2d,   0xd8, 0xc1, 0x26,   0x1e, 0x1a, 0x04,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x20, 0x1b, 0x04,   0xd6, 0xbf, 0x26,   0xfc, 0xe4, 0x2d,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe4, 0x2d,   0xd7, 0xbf, 0x26,   0x20, 0x1c, 0x05,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x1c, 0x18, 0x04,   0xcd, 0xb6, 0x24,   0xfc, 0xe5, 0x2e,   0xf1, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf1, 0xd3, 0x2a,   0xfc, 0xe6, 0x2e,   0xcd, 0xb7, 0x24,   0x1c, 0x18, 0x04,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x12, 0x0f, 0x02,   0xbc, 0xa8, 0x21,   0xfc, 0xe8, 0x2e,   0xf2, 0xd4, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe8, 0x2e,   0xbc, 0xa8, 0x21,   0x13, 0x10, 0x02,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x06, 0x05, 0x00,   0xa1, 0x8f, 0x1c,   0xfc, 0xe8, 0x2e,   0xf4, 0xd7, 0x2b,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf4, 0xd7, 0x2b,   0xfc, 0xe8, 0x2e,   0xa2, 0x8f, 0x1c,   0x07, 0x05, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x7a, 0x6b, 0x15,   0xfc, 0xe1, 0x2d,   0xfa, 0xdd, 0x2c,   0xf2, 0xd4, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd4, 0x2a,   0xfa, 0xdd, 0x2c,   0xfc, 0xe1, 0x2d,   0x7b, 0x6c, 0x15,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x4c, 0x42, 0x0c,   0xe2, 0xca, 0x29,   0xfc, 0xe5, 0x2e,   0xf2, 0xd4, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf2, 0xd4, 0x2a,   0xfc, 0xe5, 0x2d,   0xe3, 0xcb, 0x28,   0x4c, 0x43, 0x0d,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x1e, 0x19, 0x04,   0xb1, 0x9f, 0x1f,   0xfc, 0xe7, 0x2e,   0xf8, 0xda, 0x2b,   0xf3, 0xd5, 0x2a,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf2, 0xd5, 0x2a,   0xf8, 0xda, 0x2b,   0xfc, 0xe7, 0x2e,   0xb2, 0x9f, 0x20,   0x1e, 0x19, 0x04,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x6b, 0x5e, 0x12,   0xec, 0xd1, 0x2a,   0xfc, 0xe5, 0x2e,   0xf4, 0xd6, 0x2b,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd6, 0x2b,   0xfc, 0xe5, 0x2e,   0xed, 0xd2, 0x2a,   0x6b, 0x5e, 0x12,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x25, 0x20, 0x05,   0xa9, 0x97, 0x1e,   0xfc, 0xe3, 0x2d,   0xfc, 0xe0, 0x2d,   0xf2, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xe0, 0x2d,   0xfc, 0xe3, 0x2d,   0xaa, 0x98, 0x1e,   0x25, 0x20, 0x06,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x4e, 0x45, 0x0d,   0xca, 0xb4, 0x24,   0xfc, 0xe6, 0x2e,   0xfc, 0xdf, 0x2c,   0xf3, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xfc, 0xdf, 0x2c,   0xfc, 0xe6, 0x2e,   0xcb, 0xb5, 0x24,   0x4f, 0x46, 0x0d,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x04, 0x03, 0x00,   0x64, 0x59, 0x11,   0xd3, 0xbb, 0x25,   0xfc, 0xe6, 0x2e,   0xfc, 0xe1, 0x2d,   0xf4, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf3, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xfc, 0xe0, 0x2d,   0xfc, 0xe6, 0x2e,   0xd4, 0xbc, 0x25,   0x65, 0x5a, 0x11,   0x06, 0x05, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x09, 0x08, 0x01,   0x61, 0x56, 0x11,   0xc7, 0xb1, 0x23,   0xfc, 0xe2, 0x2d,   0xfc, 0xe5, 0x2e,   0xf9, 0xda, 0x2b,   0xf2, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf3, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf9, 0xda, 0x2b,   0xfc, 0xe5, 0x2e,   0xfc, 0xe2, 0x2d,   0xc8, 0xb1, 0x23,   0x61, 0x56, 0x11,   0x0a, 0x08, 0x01,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x48, 0x40, 0x0c,   0xa7, 0x93, 0x1d,   0xea, 0xd0, 0x2a,   0xfc, 0xe7, 0x2e,   0xfc, 0xe3, 0x2d,   0xf9, 0xda, 0x2b,   0xf3, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf5, 0xd7, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf6, 0xd8, 0x2b,   0xf5, 0xd7, 0x2b,   0xf4, 0xd6, 0x2b,   0xf2, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf9, 0xda, 0x2b,   0xfc, 0xe3, 0x2d,   0xfc, 0xe6, 0x2e,   0xeb, 0xd0, 0x2a,   0xa7, 0x94, 0x1d,   0x48, 0x40, 0x0c,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1d, 0x19, 0x04,   0x65, 0x59, 0x11,   0xb3, 0xa0, 0x20,   0xeb, 0xcf, 0x29,   0xfc, 0xe4, 0x2e,   0xfc, 0xe6, 0x2e,   0xfc, 0xe1, 0x2d,   0xf9, 0xda, 0x2b,   0xf4, 0xd6, 0x2b,   0xf2, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf3, 0xd5, 0x2a,   0xf3, 0xd6, 0x2b,   0xf4, 0xd6, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf5, 0xd7, 0x2b,   0xf4, 0xd6, 0x2b,   0xf3, 0xd6, 0x2b,   0xf3, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf2, 0xd5, 0x2a,   0xf4, 0xd6, 0x2b,   0xf9, 0xda, 0x2b,   0xfc, 0xe1, 0x2d,   0xfc, 0xe7, 0x2e,   0xfc, 0xe4, 0x2e,   0xec, 0xd0, 0x29,   0xb5, 0xa1, 0x20,   0x67, 0x5b, 0x12,   0x1d, 0x1a, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1c, 0x19, 0x04,   0x54, 0x4b, 0x0e,   0x95, 0x83, 0x1a,   0xc9, 0xb0, 0x23,   0xec, 0xcf, 0x29,   0xfc, 0xe0, 0x2d,   0xfc, 0xe7, 0x2e,   0xfc, 0xe7, 0x2e,   0xfc, 0xe5, 0x2e,   0xfc, 0xe2, 0x2d,   0xfc, 0xdf, 0x2c,   0xfc, 0xdd, 0x2c,   0xfb, 0xdc, 0x2c,   0xfa, 0xdb, 0x2c,   0xfa, 0xdb, 0x2c,   0xfb, 0xdc, 0x2c,   0xfc, 0xdd, 0x2c,   0xfc, 0xdf, 0x2c,   0xfc, 0xe2, 0x2d,   0xfc, 0xe5, 0x2e,   0xfc, 0xe7, 0x2e,   0xfc, 0xe7, 0x2e,   0xfc, 0xe0, 0x2d,   0xec, 0xcf, 0x29,   0xc8, 0xb0, 0x23,   0x95, 0x83, 0x1a,   0x57, 0x4d, 0x0f,   0x1d, 0x19, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x01, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x03, 0x02, 0x00,   0x01, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x1a, 0x17, 0x04,   0x3f, 0x37, 0x0a,   0x67, 0x5b, 0x12,   0x8b, 0x7a, 0x18,   0xaa, 0x96, 0x1e,   0xc0, 0xa9, 0x21,   0xd0, 0xb6, 0x24,   0xdc, 0xc1, 0x26,   0xe4, 0xc8, 0x28,   0xe7, 0xcb, 0x28,   0xe7, 0xcb, 0x28,   0xe4, 0xc8, 0x28,   0xdc, 0xc1, 0x26,   0xd0, 0xb6, 0x24,   0xc0, 0xa8, 0x21,   0xa9, 0x96, 0x1e,   0x8b, 0x7a, 0x18,   0x67, 0x5b, 0x12,   0x3f, 0x37, 0x0a,   0x1a, 0x17, 0x04,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x02, 0x02, 0x00,   0x02, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x03, 0x02, 0x00,   0x0a, 0x08, 0x01,   0x0e, 0x0c, 0x02,   0x12, 0x0f, 0x02,   0x12, 0x0f, 0x02,   0x0e, 0x0c, 0x02,   0x0a, 0x08, 0x01,   0x03, 0x02, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x02, 0x00,   0x02, 0x02, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x01, 0x00, 0x00,   0x02, 0x02, 0x00,   0x03, 0x02, 0x00,   0x03, 0x02, 0x00,   0x02, 0x01, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x02, 0x01, 0x00,   0x03, 0x02, 0x00,   0x03, 0x02, 0x00,   0x02, 0x02, 0x00,   0x01, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-	0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   0x00, 0x00, 0x00,   
-};
-#endif
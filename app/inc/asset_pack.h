@@ -0,0 +1,48 @@
+/*
+ * asset_pack.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_ASSET_PACK_H_
+#define APP_INC_ASSET_PACK_H_
+
+#include "image.h"
+
+// Asset pack (frame_gen.py -b), flashed at the start of the PACK region of the linker script
+// header, directory sorted by hash, then the payloads, each starting on PACK_ALIGN bytes
+#define PACK_MAGIC 0x4B505453 // "STPK"
+#define PACK_VERSION 1
+#define PACK_ALIGN 16
+
+// All offsets are from the start of the pack, multi-byte fields are little endian
+struct PACK_Header {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t count; // directory entries
+	uint32_t directory;
+	uint32_t size; // whole pack, payloads included
+};
+
+struct PACK_Entry {
+	uint32_t hash; // PACK_Hash of the asset name, also its ID
+	uint32_t offset;
+	uint32_t size;
+	uint8_t width;
+	uint8_t height;
+	uint8_t format; // enum PIXEL_FORMAT
+	uint8_t encoding; // enum IMG_ENCODING
+	uint32_t palette; // 0 if not indexed
+	uint16_t colors;
+	uint8_t bpp;
+	uint8_t reserved;
+};
+
+uint32_t PACK_Init(void);
+uint32_t PACK_Hash(const char* name);
+
+const struct PACK_Entry* PACK_Find(const uint32_t id);
+const uint8_t* PACK_GetData(const uint32_t id, uint32_t* size);
+uint32_t PACK_GetImage(const uint32_t id, struct IMG_Image* image);
+
+#endif /* APP_INC_ASSET_PACK_H_ */
@@ -0,0 +1,45 @@
+/*
+ * blit.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_BLIT_H_
+#define APP_INC_BLIT_H_
+
+#include "image.h"
+
+// Source pixel sampling
+enum BLIT_FILTER {
+	BLIT_FILTER_NEAREST = 0,
+	BLIT_FILTER_BILINEAR, // 4 source pixels weighted per component, 8 bits fractions
+};
+
+// Clockwise rotation of the source image, applied before scaling
+enum BLIT_ROTATION {
+	BLIT_ROTATION_0 = 0,
+	BLIT_ROTATION_90,
+	BLIT_ROTATION_180,
+	BLIT_ROTATION_270,
+};
+
+// Queued scaled / rotated draw, must stay valid until the draw handle is done
+// Source positions are 16.16 fixed point, in source pixels : (u, v) of the first visible destination pixel,
+// and their steps along a destination row (x) and down a destination column (y)
+struct BLIT_Blitter {
+	const struct IMG_Image* image;
+	enum BLIT_FILTER filter;
+	uint8_t visible_width;
+	int32_t u_start;
+	int32_t v_start;
+	int32_t du_x;
+	int32_t dv_x;
+	int32_t du_y;
+	int32_t dv_y;
+};
+
+ST7735_Handle BLIT_DrawDMA(struct BLIT_Blitter* blitter, const struct IMG_Image* image, const int16_t x_start, const int16_t y_start,
+		const uint16_t width, const uint16_t height, const enum BLIT_ROTATION rotation, const enum BLIT_FILTER filter,
+		uint8_t* buffer, const uint16_t band_lines);
+
+#endif /* APP_INC_BLIT_H_ */
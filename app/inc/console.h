@@ -0,0 +1,27 @@
+/*
+ * console.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_CONSOLE_H_
+#define APP_INC_CONSOLE_H_
+
+#include "font.h"
+
+// stm32_printf outputs (stm32_printf_output)
+#define PRINTF_OUTPUT_UART	0x01
+#define PRINTF_OUTPUT_LCD	0x02
+
+// Text grid limits (21 x 20 cells with a 6x8 font in portrait)
+#define CONSOLE_COLUMNS_MAX 32
+#define CONSOLE_ROWS_MAX 20
+
+// The console needs MV and MY clear in MADCTL (ST7735_GetMADCTL) : ORIENTATION_0 without a Y mirror, or ORIENTATION_180 with one
+// CONSOLE_Init returns 0 otherwise, and a later orientation / mirror change stops the console at its next scroll
+uint32_t CONSOLE_Init(const struct FONT_Font* font, const uint32_t color, const uint32_t background);
+void CONSOLE_PutChar(const char c);
+void CONSOLE_Clear(void);
+ST7735_Handle CONSOLE_Flush(void);
+
+#endif /* APP_INC_CONSOLE_H_ */
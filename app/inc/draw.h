@@ -0,0 +1,40 @@
+/*
+ * draw.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_DRAW_H_
+#define APP_INC_DRAW_H_
+
+#include "st7735.h"
+
+// Runs batched before being written, one window (CASET / RASET / RAMWR) per run
+#define DRAW_SPAN_MAX 64
+
+// Maximum number of polygon vertices
+#define DRAW_POLY_MAX 32
+
+// Logical display coordinates, shapes can be partly off screen
+struct DRAW_Point {
+	int16_t x;
+	int16_t y;
+};
+
+// Horizontal or vertical run of pixels (last row / columns index is included)
+struct DRAW_Span {
+	uint8_t x_start;
+	uint8_t y_start;
+	uint8_t x_end;
+	uint8_t y_end;
+};
+
+void DRAW_Line(const int16_t x0, const int16_t y0, const int16_t x1, const int16_t y1, const uint32_t color);
+void DRAW_Circle(const int16_t xc, const int16_t yc, const uint8_t radius, const uint32_t color);
+void DRAW_FillCircle(const int16_t xc, const int16_t yc, const uint8_t radius, const uint32_t color);
+void DRAW_Ellipse(const int16_t xc, const int16_t yc, const uint8_t rx, const uint8_t ry, const uint32_t color);
+void DRAW_FillEllipse(const int16_t xc, const int16_t yc, const uint8_t rx, const uint8_t ry, const uint32_t color);
+void DRAW_Polygon(const struct DRAW_Point* points, const uint32_t n, const uint32_t color);
+void DRAW_FillPolygon(const struct DRAW_Point* points, const uint32_t n, const uint32_t color);
+
+#endif /* APP_INC_DRAW_H_ */
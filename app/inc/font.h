@@ -0,0 +1,51 @@
+/*
+ * font.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_FONT_H_
+#define APP_INC_FONT_H_
+
+#include "st7735.h"
+
+// Longest line of text (landscape width) and tallest font rendered into the line buffer
+#define FONT_LINE_MAX DISPLAY_HEIGHT
+#define FONT_HEIGHT_MAX 16
+
+// Line buffer : one line of text in the largest pixel format (RGB 6-6-6)
+#define FONT_BUFFER_SIZE (FONT_LINE_MAX * FONT_HEIGHT_MAX * 3)
+
+// Proportional font glyph
+struct FONT_Glyph {
+	uint16_t offset; // first row in the bitmap
+	uint8_t width; // bitmap columns, 0 for blank glyphs
+	uint8_t advance; // pen move, spacing included
+};
+
+// Bitmap font, as generated by font_gen.py
+struct FONT_Font {
+	const uint8_t* bitmap; // glyph rows MSB first, each row starts on a byte
+	const struct FONT_Glyph* glyphs; // 0 for fixed width fonts : every glyph is 'width' columns, 'advance' apart
+	uint8_t first; // character range
+	uint8_t last;
+	uint8_t width;
+	uint8_t advance;
+	uint8_t rows; // bitmap rows per glyph
+	uint8_t height; // line height, rows below the glyphs are background
+};
+
+enum FONT_MODE {
+	FONT_MODE_FILL, // glyph cells painted with the background color, one window for the whole string
+	FONT_MODE_TRANSPARENT, // only the glyph pixels are written, one window per run of pixels
+};
+
+// Fonts generated from frame_gen/font_5x7.txt
+extern const struct FONT_Font font_5x7;
+extern const struct FONT_Font font_5x7p;
+
+uint32_t FONT_GetStringWidth(const struct FONT_Font* font, const char* text);
+ST7735_Handle FONT_DrawString(const struct FONT_Font* font, const char* text, const uint8_t x_start, const uint8_t y_start,
+		const uint32_t color, const uint32_t background, const enum FONT_MODE mode);
+
+#endif /* APP_INC_FONT_H_ */
@@ -0,0 +1,54 @@
+/*
+ * framebuffer.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_FRAMEBUFFER_H_
+#define APP_INC_FRAMEBUFFER_H_
+
+#include "st7735.h"
+
+// Pixel format of the framebuffer (444, 565 or 666, same values as frame_gen.py -f)
+// Must match the format given to ST7735_Init
+#ifndef FB_FORMAT
+#define FB_FORMAT 565
+#endif
+
+#if FB_FORMAT == 666
+#define FB_PIXEL_FORMAT PIXEL_FORMAT_666
+#define FB_BYTES(pixels) ((pixels) * 3)
+#elif FB_FORMAT == 565
+#define FB_PIXEL_FORMAT PIXEL_FORMAT_565
+#define FB_BYTES(pixels) ((pixels) * 2)
+#elif FB_FORMAT == 444
+#define FB_PIXEL_FORMAT PIXEL_FORMAT_444
+#define FB_BYTES(pixels) (((pixels) * 3 + 1) / 2)
+#else
+#error "FB_FORMAT must be 444, 565 or 666"
+#endif
+
+// Bytes per framebuffer row, total framebuffer size
+#define FB_STRIDE FB_BYTES(DISPLAY_WIDTH)
+#define FB_SIZE (FB_STRIDE * DISPLAY_HEIGHT)
+
+// Maximum number of dirty rectangles tracked between two flushes
+#define FB_DIRTY_MAX 8
+
+// Cost of a window setup (CASET + RASET + RAMWR, CS / DC toggles, ISR), in payload bytes
+// Two dirty rectangles are merged when sending their bounding box costs less than sending both
+#define FB_WINDOW_COST 24
+
+uint32_t FB_Init(void);
+uint8_t* FB_GetBuffer(void);
+
+void FB_MarkDirty(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end);
+void FB_MarkAllDirty(void);
+
+void FB_SetPixel(const uint8_t x, const uint8_t y, const uint32_t color);
+void FB_FillRectangle(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end, const uint32_t color);
+void FB_DrawImage(const void* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start);
+
+ST7735_Handle FB_Flush(void);
+
+#endif /* APP_INC_FRAMEBUFFER_H_ */
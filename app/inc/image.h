@@ -0,0 +1,73 @@
+/*
+ * image.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_IMAGE_H_
+#define APP_INC_IMAGE_H_
+
+#include "st7735.h"
+
+// Image encodings (frame_gen.py -c)
+enum IMG_ENCODING {
+	IMG_ENCODING_RAW = 0, // pixels as sent on the bus
+	IMG_ENCODING_RLE, // 1CCCCCCC + pixel : C + 1 copies, 0CCCCCCC + pixels : C + 1 literal pixels
+	IMG_ENCODING_QOI, // QOI-style ops (index, diff, luma, run, full pixel) on the components of 'format'
+	IMG_ENCODING_INDEXED, // 'bpp' bits palette indices, MSB first, rows start on a byte
+};
+
+// Size of the QOI table of recently seen pixels
+#define IMG_QOI_INDEX_SIZE 64
+
+// Largest palette (8 bpp)
+#define IMG_PALETTE_MAX 256
+
+// Component positions and widths of a driver color value, red / green / blue
+struct IMG_Components {
+	uint8_t shift[3];
+	uint8_t mask[3];
+};
+
+// Image in flash, as generated by frame_gen.py (also the asset descriptor, see assets.h)
+// Pixels are in 'format', which must be the controller pixel format when drawing
+// Indexed images don't depend on the format : their palette (RGB 8-8-8, 0xRRGGBB) is converted when drawing,
+// a copy of the image with another palette draws it in other colors
+struct IMG_Image {
+	const char* name;
+	const uint8_t* data;
+	uint32_t size;
+	uint8_t width;
+	uint8_t height;
+	enum IMG_ENCODING encoding;
+	enum PIXEL_FORMAT format;
+	const uint32_t* palette;
+	uint16_t colors;
+	uint8_t bpp; // 1, 2, 4 or 8
+};
+
+// Streaming decoder state, one per queued draw : it must stay valid until the draw handle is done
+struct IMG_Decoder {
+	const struct IMG_Image* image;
+	const uint8_t* next;
+	uint32_t previous;
+	uint32_t run; // copies of 'previous' left
+	uint32_t literals; // RLE literal pixels left
+	uint8_t visible_width;
+	union {
+		uint32_t index[IMG_QOI_INDEX_SIZE]; // QOI : recently seen pixels
+		uint32_t lut[IMG_PALETTE_MAX]; // indexed : palette in the controller format
+	};
+};
+
+void IMG_DecoderInit(struct IMG_Decoder* decoder, const struct IMG_Image* image);
+const struct IMG_Components* IMG_GetComponents(const enum PIXEL_FORMAT format);
+uint32_t IMG_ConvertColor(const uint32_t rgb, const enum PIXEL_FORMAT format);
+uint32_t IMG_LoadPixel(const uint8_t* pixels, const uint32_t i, const enum PIXEL_FORMAT format);
+void IMG_StorePixel(uint8_t* pixels, const uint32_t i, const uint32_t color, const enum PIXEL_FORMAT format);
+void IMG_DecodeRows(struct IMG_Decoder* decoder, uint8_t* pixels, const uint32_t rows);
+
+ST7735_Handle IMG_DrawDMA(struct IMG_Decoder* decoder, const struct IMG_Image* image, const uint8_t x_start, const uint8_t y_start,
+		uint8_t* buffer, const uint16_t band_lines);
+
+#endif /* APP_INC_IMAGE_H_ */
@@ -16,5 +16,6 @@
 // Functions from smallprintf.c
 extern int stm32_printf(const char *format, ...);
 extern int stm32_sprintf(char *out, const char *format, ...);
+extern void stm32_printf_output(int output);
 
 #endif /* APP_INC_MAIN_H_ */
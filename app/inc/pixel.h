@@ -0,0 +1,44 @@
+/*
+ * pixel.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_PIXEL_H_
+#define APP_INC_PIXEL_H_
+
+#include <stdint.h>
+
+// Cortex-M4 SIMD instructions (__UQADD8, __USUB8 / __SEL, __UXTB16), 4 byte channels per instruction
+// Other targets (host builds) use the portable C reference, which only needs <stdint.h>
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define PIX_SIMD 1
+#else
+#define PIX_SIMD 0
+#endif
+
+// Kernels work on byte channels : RGB 8-8-8, or RGB 6-6-6 line buffers as sent on the bus (6 MSBs used)
+// Buffers don't have to be word aligned, 'bytes' doesn't have to be a multiple of 4
+// alpha and level are weights out of 256
+
+void PIX_Blend(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes, const uint32_t alpha);
+void PIX_Fade(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint32_t level);
+void PIX_AddSaturate(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes);
+void PIX_SubSaturate(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes);
+void PIX_Clamp(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint8_t ceiling);
+
+void PIX_Convert888To666(uint8_t* dst, const uint8_t* src, const uint32_t pixels);
+void PIX_Convert888To565(uint16_t* dst, const uint8_t* src, const uint32_t pixels);
+void PIX_Convert888To444(uint8_t* dst, const uint8_t* src, const uint32_t pixels);
+
+void PIX_BlendReference(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes, const uint32_t alpha);
+void PIX_FadeReference(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint32_t level);
+void PIX_AddSaturateReference(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes);
+void PIX_SubSaturateReference(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes);
+void PIX_ClampReference(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint8_t ceiling);
+
+void PIX_Convert888To666Reference(uint8_t* dst, const uint8_t* src, const uint32_t pixels);
+void PIX_Convert888To565Reference(uint16_t* dst, const uint8_t* src, const uint32_t pixels);
+void PIX_Convert888To444Reference(uint8_t* dst, const uint8_t* src, const uint32_t pixels);
+
+#endif /* APP_INC_PIXEL_H_ */
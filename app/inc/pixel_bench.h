@@ -0,0 +1,27 @@
+/*
+ * pixel_bench.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_PIXEL_BENCH_H_
+#define APP_INC_PIXEL_BENCH_H_
+
+#include "stm32l4xx.h"
+#include "pixel.h"
+
+// One benchmark line : a 128 pixels row in RGB 8-8-8
+#define PIX_BENCH_PIXELS 128
+
+// Cycles (DWT cycle counter) of a kernel and of its C reference over PIX_BENCH_PIXELS pixels,
+// mismatch is set when their outputs differ
+struct PIX_Result {
+	const char* name;
+	uint32_t cycles;
+	uint32_t reference_cycles;
+	uint8_t mismatch;
+};
+
+uint32_t PIX_Benchmark(struct PIX_Result* results, const uint32_t n);
+
+#endif /* APP_INC_PIXEL_BENCH_H_ */
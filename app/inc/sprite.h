@@ -0,0 +1,62 @@
+/*
+ * sprite.h
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#ifndef APP_INC_SPRITE_H_
+#define APP_INC_SPRITE_H_
+
+#include "image.h"
+
+// Maximum number of sprites in a layer
+#define SPR_MAX 16
+
+// Maximum number of regions re-sent by a present, closer regions are merged beyond that
+#define SPR_REGION_MAX 8
+
+// Sprite drawn over the layer background, later sprites of the list are on top
+// The image is raw (frame_gen.py -c raw) in the controller pixel format, it can be partly off screen
+struct SPR_Sprite {
+	const struct IMG_Image* image;
+	int16_t x;
+	int16_t y;
+	uint32_t key; // transparent color (driver color value : RED_666, ...)
+	uint8_t keyed; // 0 : opaque, key is ignored
+	uint8_t visible;
+};
+
+// Rectangle re-sent by a present (last row / columns index is included)
+struct SPR_Region {
+	struct SPR_Layer* layer;
+	uint8_t x_start;
+	uint8_t y_start;
+	uint8_t x_end;
+	uint8_t y_end;
+};
+
+// Sprites composited over a background, band by band, into DMA line buffers (no framebuffer)
+// The sprites can be changed at any time, a present takes a snapshot of them
+struct SPR_Layer {
+	const struct IMG_Image* background; // raw, from (0,0), 0 or areas it doesn't cover use background_color
+	uint32_t background_color;
+	const struct SPR_Sprite* sprites;
+	uint32_t count;
+	uint8_t* buffer; // two bands of a full display row : 2 * ST7735_GetFrameSize(ST7735_GetWidth() * band_lines) bytes
+	uint16_t band_lines; // even in 4-4-4 format
+
+	// Sprites as last presented, read by the band renderer until the present handle is done
+	struct SPR_Sprite shown[SPR_MAX];
+	uint32_t shown_count;
+	struct SPR_Region regions[SPR_REGION_MAX];
+	uint32_t region_count;
+	ST7735_Handle handle;
+	uint8_t full; // whole display on the next present
+};
+
+void SPR_Init(struct SPR_Layer* layer, const struct IMG_Image* background, const uint32_t background_color,
+		const struct SPR_Sprite* sprites, const uint32_t count, uint8_t* buffer, const uint16_t band_lines);
+void SPR_Invalidate(struct SPR_Layer* layer);
+ST7735_Handle SPR_Present(struct SPR_Layer* layer);
+
+#endif /* APP_INC_SPRITE_H_ */
@@ -13,6 +13,15 @@
 #define DISPLAY_WIDTH 128
 #define DISPLAY_HEIGHT 160
 
+// Lines covered by the vertical scrolling definition (TFA + VSA + BFA)
+#ifndef ST7735_SCROLL_HEIGHT
+#define ST7735_SCROLL_HEIGHT DISPLAY_HEIGHT
+#endif
+
+// SPI clocks : writes up to PCLK2/2, reads at the clock ST7735_ReadBytes was tuned for
+#define ST7735_SPI_WRITE_MAX_HZ 32000000
+#define ST7735_SPI_READ_MAX_HZ 250000
+
 // System function commands
 #define NOP			0x00 // no operation
 #define SWRESET		0x01 // software reset
@@ -72,17 +81,110 @@
 #define GAMCTRN1	0xE1 // set Gamma adjustment (- polarity)
 #define GCV			0xFC // Gate clock variable
 
+// MADTCL bits
+#define MADCTL_MY	0x80 // row address order
+#define MADCTL_MX	0x40 // column address order
+#define MADCTL_MV	0x20 // row / column exchange
+#define MADCTL_ML	0x10 // vertical refresh order
+#define MADCTL_RGB	0x08 // RGB / BGR order
+#define MADCTL_MH	0x04 // horizontal refresh order
+
 // Colors (RGB 6-6-6 format)
 #define RED_666 	0x3F000
 #define GREEN_666	0x00FC0
 #define BLUE_666	0x0003F
 
+// Colors (RGB 5-6-5 format)
+#define RED_565 	0xF800
+#define GREEN_565	0x07E0
+#define BLUE_565	0x001F
+
+// Colors (RGB 4-4-4 format)
+#define RED_444 	0xF00
+#define GREEN_444	0x0F0
+#define BLUE_444	0x00F
+
+// Interface pixel formats (values written to COLMOD)
+enum PIXEL_FORMAT {
+	PIXEL_FORMAT_444 = 0x03, // 12 bits / pixel, 2 pixels packed in 3 bytes
+	PIXEL_FORMAT_565 = 0x05, // 16 bits / pixel, sent as one 16 bit SPI frame
+	PIXEL_FORMAT_666 = 0x06, // 18 bits / pixel, sent as 3 bytes
+};
+
+// Clockwise rotations of the picture (MADCTL MV / MX / MY)
+enum ORIENTATION {
+	ORIENTATION_0 = 0, // portrait, DISPLAY_WIDTH x DISPLAY_HEIGHT
+	ORIENTATION_90, // landscape, DISPLAY_HEIGHT x DISPLAY_WIDTH
+	ORIENTATION_180, // portrait, upside down
+	ORIENTATION_270, // landscape, upside down
+};
+
+// Number of DMA transactions that can be queued
+#define ST7735_QUEUE_SIZE 8
+
+// Pixels in the line pattern streamed by DMA fills (must be even for 4-4-4)
+#define ST7735_FILL_PATTERN_PIXELS DISPLAY_WIDTH
+
+// Transaction flags
+#define ST7735_TRANSACTION_FILL		0x01 // payload is a line pattern built from 'color' when the transaction starts
+#define ST7735_TRANSACTION_BANDS	0x02 // payload is a pair of band buffers filled by 'renderer' while the other one is sent
+#define ST7735_TRANSACTION_VSYNC	0x04 // started on the next TE edge when tearing sync is enabled
+#define ST7735_TRANSACTION_INLINE	0x08 // payload is 'data' (up to 4 bytes)
+#define ST7735_TRANSACTION_NO_WINDOW	0x10 // no CASET / RASET before the command
+#define ST7735_TRANSACTION_LOW_POWER	0x20 // RAMWR that doesn't need normal mode (keeps the current power profile)
+
+// Command lists : { command, [ST7735_CMD_DELAY |] argument count, arguments..., [delay in ms] }, ..., ST7735_CMD_END
+#define ST7735_CMD_DELAY	0x80 // a delay byte follows the arguments, CS is released while waiting
+#define ST7735_CMD_END		0xFF // end of list (NOP is 0x00, 0xFF is not a command)
+// Argument runs of at least this many bytes are sent by DMA
+#define ST7735_CMD_DMA_MIN	16
+
+// Number of presentation timestamps kept for frame pacing measurements
+#define ST7735_PRESENT_HISTORY 16
+
+// Identifies a queued transaction, handles complete in submission order
+typedef uint32_t ST7735_Handle;
+
+// Renders 'lines' scanlines starting at 'first_line' (relative to the window) into 'band', in the current pixel format
+// Called from the DMA1 Channel 3 ISR
+typedef void (*ST7735_BandRenderer)(void* context, uint8_t* band, const uint16_t first_line, const uint16_t lines);
+
+// Window + command + DMA payload, executed back to back from the DMA1 Channel 3 ISR
+struct ST7735_Transaction {
+	uint8_t xs;
+	uint8_t xe;
+	uint8_t ys;
+	uint8_t ye;
+	uint8_t command;		// usually RAMWR
+	uint8_t half_word;		// 16 bit SPI frames / DMA transfers (5-6-5 payloads)
+	uint8_t flags;			// ST7735_TRANSACTION_xxx
+	const void* payload;
+	uint32_t count;			// number of DMA transfers (bytes or half-words) per row
+	uint32_t last_count;	// number of DMA transfers of the last row, 0 => count
+	uint32_t stride;		// bytes between the start of two rows in the payload
+	uint16_t rows;			// number of rows, 0 or 1 => single contiguous payload
+	uint32_t color;			// fill color (ST7735_TRANSACTION_FILL)
+	uint16_t band_lines;	// scanlines per band (ST7735_TRANSACTION_BANDS), rows is then the number of bands
+	ST7735_BandRenderer renderer;
+	void* context;
+	uint8_t data[4];		// inline payload (ST7735_TRANSACTION_INLINE)
+	ST7735_Handle handle;	// set by ST7735_Submit
+};
+
 // For the backlight
 enum BL_STATE {
 	BL_OFF,
 	BL_ON,
 };
 
+// Display power profiles
+enum POWER_PROFILE {
+	POWER_NORMAL,
+	POWER_PARTIAL,
+	POWER_IDLE,
+	POWER_PARTIAL_IDLE,
+};
+
 enum WHICH_ID {
 	ALL_IDs,
 	ID1,
@@ -90,9 +192,17 @@ enum WHICH_ID {
 	ID3,
 };
 
-void ST7735_Init(void);
+void ST7735_Init(const enum PIXEL_FORMAT format);
 void ST7735_NVIC_Init(void);
-uint32_t ST7735_ConfigDMA(const uint32_t mem_address, const uint32_t byte_count);
+uint32_t ST7735_ConfigDMA(const uint32_t mem_address, const uint32_t data_count, const uint32_t half_word);
+
+uint32_t ST7735_SetSPIClock(const uint32_t write_max_hz, const uint32_t read_max_hz);
+
+void ST7735_RunCommandList(const uint8_t* list);
+void ST7735_SetPixelFormat(const enum PIXEL_FORMAT format);
+enum PIXEL_FORMAT ST7735_GetPixelFormat(void);
+uint32_t ST7735_GetFrameSize(const uint32_t pixel_count);
+void ST7735_Pack444(uint8_t* packed, const uint16_t* pixels, const uint32_t pixel_count);
 
 void ST7735_WriteByte(const uint8_t byte);
 void ST7735_WriteWord(const uint16_t word);
@@ -100,8 +210,38 @@ void ST7735_WriteWord(const uint16_t word);
 void ST7735_ReadBytes(const uint8_t address, uint8_t* bytes, const uint8_t n);
 void ST7735_WriteBytes(const uint8_t address, const uint8_t* bytes, const uint32_t n);
 
-void ST7735_MemoryWrite(const uint8_t* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start);
-void ST7735_MemoryWriteDMA(const uint8_t* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start);
+void ST7735_MemoryWrite(const void* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start);
+ST7735_Handle ST7735_MemoryWriteDMA(const void* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start);
+void ST7735_MemoryWriteRegion(const void* buffer, const uint32_t stride, const uint8_t src_x, const uint8_t src_y,
+		const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start);
+ST7735_Handle ST7735_MemoryWriteRegionDMA(const void* buffer, const uint32_t stride, const uint8_t src_x, const uint8_t src_y,
+		const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start);
+
+ST7735_Handle ST7735_Submit(const struct ST7735_Transaction* transaction);
+uint32_t ST7735_IsDone(const ST7735_Handle handle);
+void ST7735_Wait(const ST7735_Handle handle);
+void ST7735_WaitIdle(void);
+void ST7735_DMA_IRQHandler(void);
+
+// Scroll lines are panel GRAM lines, ST7735_ScrollLines returns 0 (nothing queued) while MV or MY is set in MADCTL
+// (only ORIENTATION_0, or ORIENTATION_180 with a Y mirror, leave both clear)
+void ST7735_SetScrollArea(const uint8_t top_fixed, const uint8_t bottom_fixed);
+void ST7735_SetScrollStart(const uint8_t line);
+uint8_t ST7735_GetScrollStart(void);
+ST7735_Handle ST7735_ScrollLines(const uint8_t lines, const void* rows);
+
+void ST7735_SetPartialArea(const uint8_t start_line, const uint8_t end_line);
+void ST7735_SetIdleFrameRate(const uint8_t rtna, const uint8_t fpa, const uint8_t bpa);
+void ST7735_SetPartialFrameRate(const uint8_t rtnc, const uint8_t fpc, const uint8_t bpc);
+void ST7735_SetPowerProfile(const enum POWER_PROFILE profile);
+enum POWER_PROFILE ST7735_GetPowerProfile(void);
+
+void ST7735_SetTearingSync(const uint32_t enable);
+void ST7735_TE_IRQHandler(void);
+uint32_t ST7735_GetTEPeriod(void);
+uint32_t ST7735_GetPresentTimestamps(uint32_t* timestamps, const uint32_t n);
+ST7735_Handle ST7735_PresentFrameDMA(const void* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size,
+		const uint8_t x_start, const uint8_t y_start);
 
 void ST7735_SendData(const uint8_t data);
 
@@ -116,7 +256,16 @@ void ST7735_SetBacklight(const enum BL_STATE state);
 void ST7735_SetColumnAddress(const uint8_t xs, const uint8_t xe);
 void ST7735_SetRowAddress(const uint8_t ys, const uint8_t ye);
 void ST7735_SetMirror(const uint32_t x_mirror, const uint32_t y_mirror);
+void ST7735_SetOrientation(const enum ORIENTATION rotation);
+enum ORIENTATION ST7735_GetOrientation(void);
+uint8_t ST7735_GetMADCTL(void);
+uint8_t ST7735_GetWidth(void);
+uint8_t ST7735_GetHeight(void);
+void ST7735_Resync(void);
 
 void ST7735_DrawRectangle(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end, const uint32_t color);
+ST7735_Handle ST7735_FillRectangleDMA(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end, const uint32_t color);
+ST7735_Handle ST7735_RenderBandsDMA(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end,
+		const uint16_t band_lines, uint8_t* buffer, const ST7735_BandRenderer renderer, void* context);
 
 #endif /* APP_INC_ST7735_H_ */
@@ -0,0 +1,93 @@
+/*
+ * asset_pack.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "asset_pack.h"
+
+// Bounds of the PACK region (linker script)
+extern const uint8_t _sasset_pack[];
+extern const uint8_t _easset_pack[];
+
+// Directory in flash, 0 until a valid pack is found
+static const struct PACK_Entry* directory = 0;
+static uint32_t entry_count = 0;
+
+uint32_t PACK_Init(void) {
+	// Checks the pack header, returns the number of assets (0 when the region is erased or holds something else)
+	const struct PACK_Header* header = (const struct PACK_Header*)_sasset_pack;
+	const uint32_t region_size = (uint32_t)(_easset_pack - _sasset_pack);
+
+	directory = 0;
+	entry_count = 0;
+
+	if (header->magic != PACK_MAGIC || header->version != PACK_VERSION) return 0;
+	if (header->size > region_size || (header->directory & 0x03) != 0) return 0;
+	if (header->directory + header->count * sizeof(struct PACK_Entry) > header->size) return 0;
+
+	directory = (const struct PACK_Entry*)(_sasset_pack + header->directory);
+	entry_count = header->count;
+
+	return entry_count;
+}
+
+uint32_t PACK_Hash(const char* name) {
+	// FNV-1a, same as frame_gen.py
+	uint32_t hash = 0x811C9DC5;
+
+	while (*name != '\0') {
+		hash ^= (uint8_t)*(name++);
+		hash *= 0x01000193;
+	}
+
+	return hash;
+}
+
+const struct PACK_Entry* PACK_Find(const uint32_t id) {
+	// Binary search over the flash-resident directory
+	uint32_t low = 0;
+	uint32_t high = entry_count;
+
+	while (low < high) {
+		const uint32_t middle = (low + high) / 2;
+		const struct PACK_Entry* entry = directory + middle;
+
+		if (entry->hash == id) return entry;
+
+		if (entry->hash < id) low = middle + 1;
+		else high = middle;
+	}
+
+	return 0;
+}
+
+const uint8_t* PACK_GetData(const uint32_t id, uint32_t* size) {
+	// Payload in flash, can be given straight to the DMA
+	const struct PACK_Entry* entry = PACK_Find(id);
+
+	if (entry == 0) return 0;
+
+	if (size != 0) *size = entry->size;
+	return _sasset_pack + entry->offset;
+}
+
+uint32_t PACK_GetImage(const uint32_t id, struct IMG_Image* image) {
+	// Descriptor pointing into the pack, for IMG_DrawDMA / ST7735_MemoryWriteDMA
+	const struct PACK_Entry* entry = PACK_Find(id);
+
+	if (entry == 0) return 0;
+
+	image->name = 0;
+	image->data = _sasset_pack + entry->offset;
+	image->size = entry->size;
+	image->width = entry->width;
+	image->height = entry->height;
+	image->encoding = (enum IMG_ENCODING)entry->encoding;
+	image->format = (enum PIXEL_FORMAT)entry->format;
+	image->palette = (entry->palette != 0) ? (const uint32_t*)(_sasset_pack + entry->palette) : 0;
+	image->colors = entry->colors;
+	image->bpp = entry->bpp;
+
+	return 1;
+}
@@ -0,0 +1,17 @@
+/*
+ * assets.c
+ *
+ *  Generated by frame_gen.py, do not edit
+ */
+
+#include "assets.h"
+
+static const struct IMG_Image* const asset_table[ASSET_COUNT] = {
+		[ASSET_FFRANK] = &ffrank_asset,
+		[ASSET_SMILEY] = &smiley_asset,
+};
+
+const struct IMG_Image* ASSET_Get(const enum ASSET_ID id) {
+	if (id >= ASSET_COUNT) return 0;
+	return asset_table[id];
+}
@@ -0,0 +1,160 @@
+/*
+ * blit.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "blit.h"
+
+static int32_t BLIT_Clamp(const int32_t position, const int32_t last) {
+	// Samples past the image edges repeat the edge pixels
+	if (position < 0) return 0;
+	if (position > last) return last;
+	return position;
+}
+
+static uint32_t BLIT_Bilinear(const struct IMG_Image* image, const int32_t u, const int32_t v) {
+	// 2x2 source pixels around (u, v), each component weighted by the 8 bits fractions
+	const struct IMG_Components* components = IMG_GetComponents(image->format);
+	const int32_t uc = BLIT_Clamp(u, (image->width - 1) << 16);
+	const int32_t vc = BLIT_Clamp(v, (image->height - 1) << 16);
+
+	const uint32_t x0 = uc >> 16;
+	const uint32_t y0 = vc >> 16;
+	const uint32_t x1 = (x0 + 1 < image->width) ? x0 + 1 : x0;
+	const uint32_t y1 = (y0 + 1 < image->height) ? y0 + 1 : y0;
+	const uint32_t fx = (uc >> 8) & 0xFF;
+	const uint32_t fy = (vc >> 8) & 0xFF;
+
+	const uint32_t c00 = IMG_LoadPixel(image->data, y0 * image->width + x0, image->format);
+	const uint32_t c10 = IMG_LoadPixel(image->data, y0 * image->width + x1, image->format);
+	const uint32_t c01 = IMG_LoadPixel(image->data, y1 * image->width + x0, image->format);
+	const uint32_t c11 = IMG_LoadPixel(image->data, y1 * image->width + x1, image->format);
+
+	uint32_t color = 0;
+
+	for (uint32_t c = 0; c < 3; ++c) {
+		const uint8_t shift = components->shift[c];
+		const uint8_t mask = components->mask[c];
+
+		const uint32_t top = ((c00 >> shift) & mask) * (256 - fx) + ((c10 >> shift) & mask) * fx;
+		const uint32_t bottom = ((c01 >> shift) & mask) * (256 - fx) + ((c11 >> shift) & mask) * fx;
+
+		color |= ((top * (256 - fy) + bottom * fy + 0x8000) >> 16) << shift;
+	}
+
+	return color;
+}
+
+static void BLIT_RenderBand(void* context, uint8_t* band, const uint16_t first_line, const uint16_t lines) {
+	// Band renderer, called from the DMA1 Channel 3 ISR : rows are computed from first_line, no state carried between bands
+	const struct BLIT_Blitter* blitter = (const struct BLIT_Blitter*)context;
+	const struct IMG_Image* image = blitter->image;
+	const enum PIXEL_FORMAT format = image->format;
+	const int32_t u_last = (image->width - 1) << 16;
+	const int32_t v_last = (image->height - 1) << 16;
+	uint32_t i = 0;
+
+	for (uint32_t row = first_line; row < (uint32_t)(first_line + lines); ++row) {
+		int32_t u = blitter->u_start + (int32_t)row * blitter->du_y;
+		int32_t v = blitter->v_start + (int32_t)row * blitter->dv_y;
+
+		if (blitter->filter == BLIT_FILTER_BILINEAR) {
+			for (uint32_t x = 0; x < blitter->visible_width; ++x, u += blitter->du_x, v += blitter->dv_x) {
+				IMG_StorePixel(band, i++, BLIT_Bilinear(image, u, v), format);
+			}
+			continue;
+		}
+
+		// Nearest : closest source pixel center
+		for (uint32_t x = 0; x < blitter->visible_width; ++x, u += blitter->du_x, v += blitter->dv_x) {
+			const uint32_t source_x = (BLIT_Clamp(u, u_last) + 0x8000) >> 16;
+			const uint32_t source_y = (BLIT_Clamp(v, v_last) + 0x8000) >> 16;
+
+			IMG_StorePixel(band, i++, IMG_LoadPixel(image->data, source_y * image->width + source_x, format), format);
+		}
+	}
+}
+
+ST7735_Handle BLIT_DrawDMA(struct BLIT_Blitter* blitter, const struct IMG_Image* image, const int16_t x_start, const int16_t y_start,
+		const uint16_t width, const uint16_t height, const enum BLIT_ROTATION rotation, const enum BLIT_FILTER filter,
+		uint8_t* buffer, const uint16_t band_lines) {
+	// Draws the raw image rotated then scaled to width x height at (x_start, y_start), one asset for every size
+	// Rows are resampled band_lines at a time into one half of buffer while DMA1 Channel 3 sends the other half
+	// buffer holds 2 * ST7735_GetFrameSize(visible width * band_lines) bytes (half-word aligned in 5-6-5, band_lines even in 4-4-4)
+	// The destination can be larger than the display and partly off screen (zoom), it is clipped to the logical display bounds
+
+	// Nothing to queue, handle 0 is always done
+	if (image->encoding != IMG_ENCODING_RAW || image->format != ST7735_GetPixelFormat()) return 0;
+	if (width == 0 || height == 0) return 0;
+
+	const int32_t x_end = x_start + width - 1;
+	const int32_t y_end = y_start + height - 1;
+	if (x_end < 0 || y_end < 0 || x_start >= ST7735_GetWidth() || y_start >= ST7735_GetHeight()) return 0;
+
+	const int32_t x_skip = (x_start < 0) ? -x_start : 0;
+	const int32_t y_skip = (y_start < 0) ? -y_start : 0;
+	const uint8_t x_first = x_start + x_skip;
+	const uint8_t y_first = y_start + y_skip;
+	const uint8_t x_last = (x_end > ST7735_GetWidth() - 1) ? ST7735_GetWidth() - 1 : x_end;
+	const uint8_t y_last = (y_end > ST7735_GetHeight() - 1) ? ST7735_GetHeight() - 1 : y_end;
+
+	// Size of the rotated source, and source pixels per destination pixel (16.16)
+	const uint32_t quarter = (rotation == BLIT_ROTATION_90 || rotation == BLIT_ROTATION_270);
+	const uint32_t rotated_width = quarter ? image->height : image->width;
+	const uint32_t rotated_height = quarter ? image->width : image->height;
+	const int32_t step_x = (rotated_width << 16) / width;
+	const int32_t step_y = (rotated_height << 16) / height;
+
+	// Rotated source position of the center of destination pixel (0, 0), pixel centers aligned
+	const int32_t p = step_x / 2 - 0x8000;
+	const int32_t q = step_y / 2 - 0x8000;
+	const int32_t u_last = (image->width - 1) << 16;
+	const int32_t v_last = (image->height - 1) << 16;
+
+	// Rotated (p, q) to source (u, v), the steppers follow
+	switch (rotation) {
+	case BLIT_ROTATION_90:
+		blitter->u_start = q;
+		blitter->v_start = v_last - p;
+		blitter->du_x = 0;
+		blitter->dv_x = -step_x;
+		blitter->du_y = step_y;
+		blitter->dv_y = 0;
+		break;
+	case BLIT_ROTATION_180:
+		blitter->u_start = u_last - p;
+		blitter->v_start = v_last - q;
+		blitter->du_x = -step_x;
+		blitter->dv_x = 0;
+		blitter->du_y = 0;
+		blitter->dv_y = -step_y;
+		break;
+	case BLIT_ROTATION_270:
+		blitter->u_start = u_last - q;
+		blitter->v_start = p;
+		blitter->du_x = 0;
+		blitter->dv_x = step_x;
+		blitter->du_y = -step_y;
+		blitter->dv_y = 0;
+		break;
+	default:
+		blitter->u_start = p;
+		blitter->v_start = q;
+		blitter->du_x = step_x;
+		blitter->dv_x = 0;
+		blitter->du_y = 0;
+		blitter->dv_y = step_y;
+		break;
+	}
+
+	// Clipped columns and rows
+	blitter->u_start += x_skip * blitter->du_x + y_skip * blitter->du_y;
+	blitter->v_start += x_skip * blitter->dv_x + y_skip * blitter->dv_y;
+
+	blitter->image = image;
+	blitter->filter = filter;
+	blitter->visible_width = x_last - x_first + 1;
+
+	return ST7735_RenderBandsDMA(x_first, y_first, x_last, y_last, band_lines, buffer, BLIT_RenderBand, blitter);
+}
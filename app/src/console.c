@@ -0,0 +1,153 @@
+/*
+ * console.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h>
+#include "console.h"
+
+// Text grid in GRAM order : row 'first_row' is shown at the top of the screen
+static char cells[CONSOLE_ROWS_MAX][CONSOLE_COLUMNS_MAX];
+
+// One bit per cell changed since the last flush
+static uint32_t dirty[CONSOLE_ROWS_MAX];
+
+static const struct FONT_Font* console_font = 0;
+static uint32_t console_color = 0;
+static uint32_t console_background = 0;
+static uint8_t columns = 0;
+static uint8_t rows = 0;
+static uint8_t first_row = 0;
+static uint8_t cursor_row = 0; // from the top of the screen
+static uint8_t cursor_column = 0;
+static ST7735_Handle console_handle = 0;
+
+static void CONSOLE_SetCell(const uint32_t row, const uint32_t column, const char c) {
+	if (cells[row][column] == c) return;
+
+	cells[row][column] = c;
+	dirty[row] |= 1UL << column;
+}
+
+static uint32_t CONSOLE_CanScroll(void) {
+	// Text rows are GRAM lines : the hardware scroll only follows them with MV and MY clear
+	return (ST7735_GetMADCTL() & (MADCTL_MV | MADCTL_MY)) == 0;
+}
+
+static void CONSOLE_NewLine(void) {
+	cursor_column = 0;
+
+	if (cursor_row + 1 < rows) {
+		++cursor_row;
+		return;
+	}
+
+	// The orientation or a mirror changed since CONSOLE_Init : the console stops until it's initialized again
+	if (!CONSOLE_CanScroll()) {
+		console_font = 0;
+		return;
+	}
+
+	// Last row : the top row is blanked, then becomes the bottom one by moving the scroll start,
+	// the other rows stay in GRAM and are not sent again
+	for (uint32_t column = 0; column < columns; ++column) CONSOLE_SetCell(first_row, column, ' ');
+	CONSOLE_Flush();
+
+	first_row = (first_row + 1) % rows;
+
+	// Waits for the flush
+	ST7735_SetScrollStart(first_row * console_font->height);
+}
+
+uint32_t CONSOLE_Init(const struct FONT_Font* font, const uint32_t color, const uint32_t background) {
+	// Fixed width fonts only, in ORIENTATION_0 (or ORIENTATION_180 with a Y mirror) : the hardware scroll runs down the panel lines
+	if (font->glyphs != 0 || !CONSOLE_CanScroll()) return 0;
+
+	const uint32_t grid_columns = ST7735_GetWidth() / font->advance;
+	const uint32_t grid_rows = ST7735_GetHeight() / font->height;
+	if (grid_columns == 0 || grid_rows == 0) return 0;
+
+	console_font = font;
+	console_color = color;
+	console_background = background;
+	columns = (grid_columns > CONSOLE_COLUMNS_MAX) ? CONSOLE_COLUMNS_MAX : grid_columns;
+	rows = (grid_rows > CONSOLE_ROWS_MAX) ? CONSOLE_ROWS_MAX : grid_rows;
+
+	// The text rows scroll, lines below the last one stay in place
+	ST7735_SetScrollArea(0, ST7735_SCROLL_HEIGHT - rows * font->height);
+
+	CONSOLE_Clear();
+
+	return 1;
+}
+
+void CONSOLE_Clear(void) {
+	if (console_font == 0) return;
+
+	memset(cells, ' ', sizeof(cells));
+	memset(dirty, 0, sizeof(dirty));
+
+	first_row = 0;
+	cursor_row = 0;
+	cursor_column = 0;
+
+	ST7735_SetScrollStart(0);
+
+	console_handle = ST7735_FillRectangleDMA(0, 0, ST7735_GetWidth() - 1, rows * console_font->height - 1, console_background);
+}
+
+void CONSOLE_PutChar(const char c) {
+	// Characters only update the grid, the panel is written on '\n' or by CONSOLE_Flush
+	if (console_font == 0) return;
+
+	if (c == '\r') {
+		cursor_column = 0;
+		return;
+	}
+
+	if (c == '\n') {
+		CONSOLE_NewLine();
+		CONSOLE_Flush();
+		return;
+	}
+
+	if (c == '\b') {
+		if (cursor_column != 0) --cursor_column;
+		return;
+	}
+
+	// Wraps when the next character doesn't fit, a line of exactly 'columns' characters doesn't leave a blank row
+	if (cursor_column == columns) CONSOLE_NewLine();
+
+	CONSOLE_SetCell((first_row + cursor_row) % rows, cursor_column, c);
+	++cursor_column;
+}
+
+ST7735_Handle CONSOLE_Flush(void) {
+	// One string write per row with changes, from its first to its last changed cell
+	char text[CONSOLE_COLUMNS_MAX + 1];
+
+	if (console_font == 0) return 0;
+
+	for (uint32_t row = 0; row < rows; ++row) {
+		if (dirty[row] == 0) continue;
+
+		uint32_t first = 0;
+		uint32_t last = columns - 1;
+		while ((dirty[row] & (1UL << first)) == 0) ++first;
+		while ((dirty[row] & (1UL << last)) == 0) --last;
+
+		const uint32_t length = last - first + 1;
+		memcpy(text, &cells[row][first], length);
+		text[length] = '\0';
+
+		// GRAM lines : the scroll start moves, rows don't
+		console_handle = FONT_DrawString(console_font, text, first * console_font->advance, row * console_font->height,
+				console_color, console_background, FONT_MODE_FILL);
+
+		dirty[row] = 0;
+	}
+
+	return console_handle;
+}
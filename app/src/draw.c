@@ -0,0 +1,301 @@
+/*
+ * draw.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "draw.h"
+
+// Polygon edge, x at the center of the current scanline (16.16 fixed point)
+struct DRAW_Edge {
+	int32_t y_start;
+	int32_t y_end; // excluded
+	int32_t x;
+	int32_t dx; // per scanline
+};
+
+// Runs of the current shape, all of span_color
+static struct DRAW_Span spans[DRAW_SPAN_MAX];
+static uint32_t span_count = 0;
+static uint32_t span_color = 0;
+
+static struct DRAW_Edge edges[DRAW_POLY_MAX];
+static uint32_t active[DRAW_POLY_MAX];
+
+static void DRAW_Flush(void) {
+	// One polled windowed write per run, CASET / RASET are skipped when unchanged (register shadow)
+	for (uint32_t i = 0; i < span_count; ++i) {
+		const struct DRAW_Span* span = &spans[i];
+		ST7735_DrawRectangle(span->x_start, span->y_start, span->x_end, span->y_end, span_color);
+	}
+
+	span_count = 0;
+}
+
+static uint32_t DRAW_Merge(struct DRAW_Span* span, const struct DRAW_Span* run) {
+	// Two runs of the same row (or column) that overlap or touch become one
+	if (span->y_start == span->y_end && run->y_start == run->y_end && span->y_start == run->y_start &&
+			run->x_start <= span->x_end + 1 && span->x_start <= run->x_end + 1) {
+		if (run->x_start < span->x_start) span->x_start = run->x_start;
+		if (run->x_end > span->x_end) span->x_end = run->x_end;
+		return 1;
+	}
+
+	if (span->x_start == span->x_end && run->x_start == run->x_end && span->x_start == run->x_start &&
+			run->y_start <= span->y_end + 1 && span->y_start <= run->y_end + 1) {
+		if (run->y_start < span->y_start) span->y_start = run->y_start;
+		if (run->y_end > span->y_end) span->y_end = run->y_end;
+		return 1;
+	}
+
+	return 0;
+}
+
+static void DRAW_AddRun(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+	// Horizontal or vertical run, clipped to the logical display bounds
+	if (x1 < x0) { const int32_t x = x0; x0 = x1; x1 = x; }
+	if (y1 < y0) { const int32_t y = y0; y0 = y1; y1 = y; }
+
+	if (x1 < 0 || y1 < 0 || x0 > ST7735_GetWidth() - 1 || y0 > ST7735_GetHeight() - 1) return;
+
+	const struct DRAW_Span run = {
+			.x_start = (x0 < 0) ? 0 : x0,
+			.y_start = (y0 < 0) ? 0 : y0,
+			.x_end = (x1 > ST7735_GetWidth() - 1) ? ST7735_GetWidth() - 1 : x1,
+			.y_end = (y1 > ST7735_GetHeight() - 1) ? ST7735_GetHeight() - 1 : y1,
+	};
+
+	// Most recent runs first, they are the most likely neighbors
+	for (uint32_t i = span_count; i > 0; --i) {
+		if (DRAW_Merge(&spans[i - 1], &run)) return;
+	}
+
+	if (span_count == DRAW_SPAN_MAX) DRAW_Flush();
+
+	spans[span_count++] = run;
+}
+
+static void DRAW_LineRuns(const int32_t x0, const int32_t y0, const int32_t x1, const int32_t y1) {
+	// Bresenham, pixels collected in runs along the major axis : rows for flat lines, columns for steep ones
+	const int32_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+	const int32_t dy = (y1 > y0) ? y0 - y1 : y1 - y0;
+	const int32_t sx = (x0 < x1) ? 1 : -1;
+	const int32_t sy = (y0 < y1) ? 1 : -1;
+	const uint32_t steep = (-dy > dx);
+
+	int32_t error = dx + dy;
+	int32_t x = x0;
+	int32_t y = y0;
+	int32_t run_x = x0;
+	int32_t run_y = y0;
+
+	while (x != x1 || y != y1) {
+		const int32_t e2 = 2 * error;
+		int32_t next_x = x;
+		int32_t next_y = y;
+
+		if (e2 >= dy) {
+			error += dy;
+			next_x += sx;
+		}
+		if (e2 <= dx) {
+			error += dx;
+			next_y += sy;
+		}
+
+		// Step on the minor axis : the run ends here
+		if ((steep && next_x != x) || (!steep && next_y != y)) {
+			DRAW_AddRun(run_x, run_y, x, y);
+			run_x = next_x;
+			run_y = next_y;
+		}
+
+		x = next_x;
+		y = next_y;
+	}
+
+	DRAW_AddRun(run_x, run_y, x, y);
+}
+
+static void DRAW_EllipsePoints(const int32_t xc, const int32_t yc, const int32_t x, const int32_t y, const uint32_t fill) {
+	if (fill) {
+		DRAW_AddRun(xc - x, yc - y, xc + x, yc - y);
+		DRAW_AddRun(xc - x, yc + y, xc + x, yc + y);
+		return;
+	}
+
+	// Consecutive points become runs when merged
+	DRAW_AddRun(xc + x, yc + y, xc + x, yc + y);
+	DRAW_AddRun(xc - x, yc + y, xc - x, yc + y);
+	DRAW_AddRun(xc + x, yc - y, xc + x, yc - y);
+	DRAW_AddRun(xc - x, yc - y, xc - x, yc - y);
+}
+
+static void DRAW_EllipseRuns(const int32_t xc, const int32_t yc, const int32_t rx, const int32_t ry, const uint32_t fill) {
+	// Midpoint ellipse, decision variables scaled by 4 to stay in integers (64 bits : rx^2 * ry^2 overflows 32 bits)
+	const int64_t rx2 = (int64_t)rx * rx;
+	const int64_t ry2 = (int64_t)ry * ry;
+
+	if (ry == 0) {
+		DRAW_AddRun(xc - rx, yc, xc + rx, yc);
+		return;
+	}
+
+	int32_t x = 0;
+	int32_t y = ry;
+	int64_t px = 0;
+	int64_t py = 2 * rx2 * y;
+
+	// Region 1 : slope above -1, x steps every pixel
+	int64_t p = 4 * ry2 - 4 * rx2 * ry + rx2;
+
+	while (px < py) {
+		DRAW_EllipsePoints(xc, yc, x, y, fill);
+
+		++x;
+		px += 2 * ry2;
+
+		if (p < 0) {
+			p += 4 * (ry2 + px);
+		}
+		else {
+			--y;
+			py -= 2 * rx2;
+			p += 4 * (ry2 + px - py);
+		}
+	}
+
+	// Region 2 : y steps every pixel
+	p = ry2 * (2 * x + 1) * (2 * x + 1) + 4 * rx2 * (y - 1) * (y - 1) - 4 * rx2 * ry2;
+
+	while (y >= 0) {
+		DRAW_EllipsePoints(xc, yc, x, y, fill);
+
+		--y;
+		py -= 2 * rx2;
+
+		if (p > 0) {
+			p += 4 * (rx2 - py);
+		}
+		else {
+			++x;
+			px += 2 * ry2;
+			p += 4 * (rx2 - py + px);
+		}
+	}
+}
+
+void DRAW_Line(const int16_t x0, const int16_t y0, const int16_t x1, const int16_t y1, const uint32_t color) {
+	span_color = color;
+	DRAW_LineRuns(x0, y0, x1, y1);
+	DRAW_Flush();
+}
+
+void DRAW_Ellipse(const int16_t xc, const int16_t yc, const uint8_t rx, const uint8_t ry, const uint32_t color) {
+	span_color = color;
+	DRAW_EllipseRuns(xc, yc, rx, ry, 0);
+	DRAW_Flush();
+}
+
+void DRAW_FillEllipse(const int16_t xc, const int16_t yc, const uint8_t rx, const uint8_t ry, const uint32_t color) {
+	span_color = color;
+	DRAW_EllipseRuns(xc, yc, rx, ry, 1);
+	DRAW_Flush();
+}
+
+void DRAW_Circle(const int16_t xc, const int16_t yc, const uint8_t radius, const uint32_t color) {
+	DRAW_Ellipse(xc, yc, radius, radius, color);
+}
+
+void DRAW_FillCircle(const int16_t xc, const int16_t yc, const uint8_t radius, const uint32_t color) {
+	DRAW_FillEllipse(xc, yc, radius, radius, color);
+}
+
+void DRAW_Polygon(const struct DRAW_Point* points, const uint32_t n, const uint32_t color) {
+	// Closed outline
+	if (n == 0) return;
+
+	span_color = color;
+
+	for (uint32_t i = 0; i < n; ++i) {
+		const struct DRAW_Point* a = &points[i];
+		const struct DRAW_Point* b = &points[(i + 1) % n];
+		DRAW_LineRuns(a->x, a->y, b->x, b->y);
+	}
+
+	DRAW_Flush();
+}
+
+void DRAW_FillPolygon(const struct DRAW_Point* points, const uint32_t n, const uint32_t color) {
+	// Scanline fill with an edge table (even-odd rule, convex or concave)
+	// A pixel is inside when its center is, so adjacent polygons sharing an edge don't overlap
+	if (n < 3 || n > DRAW_POLY_MAX) return;
+
+	uint32_t edge_count = 0;
+
+	// Edge table sorted by first scanline, horizontal edges are dropped
+	for (uint32_t i = 0; i < n; ++i) {
+		const struct DRAW_Point* a = &points[i];
+		const struct DRAW_Point* b = &points[(i + 1) % n];
+		if (a->y == b->y) continue;
+
+		const struct DRAW_Point* top = (a->y < b->y) ? a : b;
+		const struct DRAW_Point* bottom = (a->y < b->y) ? b : a;
+
+		struct DRAW_Edge edge = {
+				.y_start = top->y,
+				.y_end = bottom->y,
+				.dx = (int32_t)(((int64_t)(bottom->x - top->x) << 16) / (bottom->y - top->y)),
+		};
+		edge.x = ((int32_t)top->x << 16) + edge.dx / 2;
+
+		uint32_t j = edge_count++;
+		for (; j > 0 && edges[j - 1].y_start > edge.y_start; --j) edges[j] = edges[j - 1];
+		edges[j] = edge;
+	}
+
+	if (edge_count == 0) return;
+
+	int32_t y_last = edges[0].y_end;
+	for (uint32_t i = 1; i < edge_count; ++i) {
+		if (edges[i].y_end > y_last) y_last = edges[i].y_end;
+	}
+	if (y_last > ST7735_GetHeight()) y_last = ST7735_GetHeight();
+
+	span_color = color;
+
+	uint32_t next = 0;
+	uint32_t active_count = 0;
+
+	for (int32_t y = edges[0].y_start; y < y_last; ++y) {
+		// Edges starting on this scanline join the active list, finished ones leave it
+		while (next < edge_count && edges[next].y_start == y) active[active_count++] = next++;
+
+		for (uint32_t i = 0; i < active_count;) {
+			if (edges[active[i]].y_end <= y) active[i] = active[--active_count];
+			else ++i;
+		}
+
+		// Sorted by x, nearly sorted from the previous scanline
+		for (uint32_t i = 1; i < active_count; ++i) {
+			const uint32_t edge = active[i];
+			uint32_t j = i;
+			for (; j > 0 && edges[active[j - 1]].x > edges[edge].x; --j) active[j] = active[j - 1];
+			active[j] = edge;
+		}
+
+		// Pixels whose center lies between each pair of crossings
+		if (y >= 0) {
+			for (uint32_t i = 0; i + 1 < active_count; i += 2) {
+				const int32_t x_start = (edges[active[i]].x - 0x8000 + 0xFFFF) >> 16;
+				const int32_t x_end = ((edges[active[i + 1]].x - 0x8000 + 0xFFFF) >> 16) - 1;
+
+				if (x_end >= x_start) DRAW_AddRun(x_start, y, x_end, y);
+			}
+		}
+
+		for (uint32_t i = 0; i < active_count; ++i) edges[active[i]].x += edges[active[i]].dx;
+	}
+
+	DRAW_Flush();
+}
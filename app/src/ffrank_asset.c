@@ -1,51 +1,61 @@
-#ifndef FFRANK_FRAME_H
-#define FFRANK_FRAME_H
+/*
+ * ffrank_asset.c
+ *
+ *  Generated by frame_gen.py, do not edit
+ */
+// asset : ffrank 40 40
 
-#define FFRANK_WIDTH 40
-#define FFRANK_HEIGHT 40
+#include "assets.h"
 
-typedef unsigned char uint8_t;
+static const uint8_t ffrank_data[] __attribute__((section(".assets"), aligned(ASSET_ALIGN))) = {
+	0x62, 0x59, 0x56,   0x63, 0x59, 0x57,   0x78, 0x6e, 0x6c,   0x7c, 0x72, 0x6e,   0x81, 0x78, 0x73,   0x91, 0x88, 0x83,   0x8a, 0x80, 0x7c,   0x84, 0x7a, 0x76,   0xa5, 0x9c, 0x98,   0x70, 0x67, 0x67,   0x3d, 0x33, 0x38,   0x30, 0x29, 0x2f,   0x2e, 0x2a, 0x2f,   0x32, 0x2d, 0x33,   0x38, 0x32, 0x39,   0x44, 0x3c, 0x3f,   0x64, 0x59, 0x59,   0x70, 0x65, 0x66,   0x60, 0x56, 0x55,   0x65, 0x5a, 0x5a,   0x66, 0x5d, 0x5b,   0x5e, 0x56, 0x54,   0x6c, 0x65, 0x60,   0x6e, 0x67, 0x61,   0x66, 0x5d, 0x57,   0x6b, 0x62, 0x5d,   0x84, 0x7a, 0x74,   0x73, 0x6b, 0x63,   0x5d, 0x59, 0x50,   0x70, 0x68, 0x62,   0x6a, 0x62, 0x5d,   0x61, 0x5a, 0x54,   0x83, 0x7a, 0x75,   0x76, 0x6c, 0x65,   0x67, 0x5c, 0x58,   0x6e, 0x63, 0x5f,   0x75, 0x6a, 0x66,   0x6b, 0x60, 0x5c,   0x69, 0x5e, 0x5a,   0x6a, 0x5f, 0x5b,
+	0x62, 0x5b, 0x59,   0x60, 0x58, 0x56,   0x62, 0x59, 0x57,   0x58, 0x4f, 0x4e,   0x5a, 0x52, 0x50,   0x5f, 0x57, 0x53,   0x79, 0x70, 0x6d,   0x8d, 0x85, 0x83,   0x50, 0x49, 0x4a,   0x1e, 0x17, 0x1a,   0x1b, 0x17, 0x1c,   0x1d, 0x18, 0x1f,   0x1a, 0x19, 0x1f,   0x23, 0x21, 0x26,   0x1a, 0x17, 0x1b,   0x14, 0x11, 0x13,   0x2c, 0x22, 0x26,   0x45, 0x3b, 0x3f,   0x40, 0x36, 0x3a,   0x57, 0x4e, 0x4e,   0x76, 0x6d, 0x6b,   0x6e, 0x66, 0x63,   0x65, 0x5e, 0x5a,   0x59, 0x52, 0x4f,   0x6b, 0x62, 0x5f,   0x69, 0x60, 0x5c,   0x76, 0x6d, 0x67,   0x6c, 0x64, 0x5d,   0x60, 0x5b, 0x54,   0x66, 0x60, 0x59,   0x64, 0x5d, 0x57,   0x60, 0x58, 0x53,   0x67, 0x5e, 0x59,   0x76, 0x6c, 0x66,   0x7a, 0x6e, 0x6a,   0x7d, 0x72, 0x6e,   0x7f, 0x74, 0x70,   0x6b, 0x60, 0x5c,   0x70, 0x65, 0x61,   0x6a, 0x5f, 0x5b,
+	0x4a, 0x44, 0x44,   0x4d, 0x45, 0x46,   0x55, 0x4d, 0x4f,   0x57, 0x4f, 0x50,   0x40, 0x37, 0x38,   0x52, 0x49, 0x48,   0x63, 0x5e, 0x5d,   0x37, 0x33, 0x33,   0x0f, 0x09, 0x0b,   0x11, 0x0e, 0x11,   0x20, 0x1c, 0x1f,   0x33, 0x2a, 0x2d,   0x5a, 0x4d, 0x50,   0x66, 0x54, 0x55,   0x55, 0x40, 0x41,   0x30, 0x20, 0x22,   0x14, 0x0d, 0x0f,   0x0f, 0x0b, 0x0d,   0x17, 0x11, 0x16,   0x3d, 0x37, 0x3c,   0x63, 0x5a, 0x5b,   0x60, 0x58, 0x54,   0x4c, 0x44, 0x42,   0x3c, 0x33, 0x32,   0x60, 0x56, 0x55,   0x6a, 0x60, 0x5d,   0x6c, 0x64, 0x5f,   0x61, 0x5b, 0x55,   0x6a, 0x63, 0x5e,   0x6f, 0x68, 0x62,   0x72, 0x69, 0x64,   0x7c, 0x72, 0x6d,   0x85, 0x7c, 0x77,   0x70, 0x67, 0x62,   0x7f, 0x74, 0x6e,   0x85, 0x7a, 0x74,   0x83, 0x78, 0x72,   0x7a, 0x6f, 0x6b,   0x64, 0x59, 0x55,   0x7d, 0x71, 0x6d,
+	0x54, 0x53, 0x54,   0x5b, 0x57, 0x58,   0x54, 0x4f, 0x4f,   0x4d, 0x47, 0x48,   0x4f, 0x49, 0x4c,   0x52, 0x4c, 0x50,   0x4c, 0x49, 0x4b,   0x10, 0x0c, 0x0d,   0x14, 0x0d, 0x0f,   0x4a, 0x38, 0x3a,   0x79, 0x5f, 0x61,   0xad, 0x93, 0x95,   0xe0, 0xc8, 0xcb,   0xe1, 0xc7, 0xc8,   0xd3, 0xb5, 0xb5,   0xb1, 0x91, 0x90,   0x5b, 0x46, 0x43,   0x1a, 0x13, 0x15,   0x20, 0x1a, 0x21,   0x22, 0x1d, 0x25,   0x32, 0x2d, 0x33,   0x6e, 0x66, 0x66,   0x62, 0x59, 0x57,   0x61, 0x58, 0x57,   0x77, 0x6e, 0x6b,   0x6f, 0x66, 0x60,   0x64, 0x5c, 0x56,   0x69, 0x61, 0x5b,   0x6c, 0x65, 0x5e,   0x70, 0x69, 0x62,   0x79, 0x70, 0x6b,   0x80, 0x77, 0x71,   0x82, 0x78, 0x75,   0x88, 0x7e, 0x7a,   0x8b, 0x80, 0x7b,   0x7f, 0x74, 0x6e,   0x7f, 0x75, 0x6f,   0x8e, 0x83, 0x7f,   0x8d, 0x81, 0x7d,   0x88, 0x7d, 0x77,
+	0x8b, 0x8c, 0x8f,   0x92, 0x91, 0x94,   0x82, 0x80, 0x82,   0x7b, 0x78, 0x7b,   0x81, 0x7e, 0x84,   0x89, 0x87, 0x8e,   0x3c, 0x3b, 0x3e,   0x03, 0x01, 0x02,   0x65, 0x4f, 0x4d,   0xd1, 0xab, 0xa5,   0xe1, 0xbe, 0xbc,   0xea, 0xcf, 0xce,   0xe6, 0xd0, 0xd4,   0xe4, 0xcc, 0xd0,   0xdd, 0xc2, 0xc2,   0xd4, 0xb3, 0xaf,   0xa0, 0x7e, 0x79,   0x37, 0x29, 0x2b,   0x20, 0x1a, 0x21,   0x21, 0x1c, 0x24,   0x29, 0x25, 0x2c,   0x66, 0x62, 0x66,   0x66, 0x60, 0x62,   0x5e, 0x59, 0x5b,   0x6e, 0x67, 0x67,   0x63, 0x5c, 0x59,   0x55, 0x50, 0x4c,   0x5d, 0x57, 0x53,   0x59, 0x54, 0x4f,   0x6a, 0x66, 0x60,   0x77, 0x71, 0x6d,   0x6e, 0x68, 0x65,   0x79, 0x72, 0x70,   0x7f, 0x78, 0x77,   0x81, 0x7a, 0x76,   0x81, 0x79, 0x75,   0x7d, 0x76, 0x72,   0x7a, 0x73, 0x6f,   0x79, 0x71, 0x6d,   0x78, 0x71, 0x6e,
+	0x67, 0x67, 0x69,   0x6e, 0x6e, 0x6f,   0x76, 0x76, 0x77,   0x79, 0x78, 0x79,   0x65, 0x63, 0x68,   0x6a, 0x68, 0x6d,   0x18, 0x19, 0x1b,   0x20, 0x15, 0x16,   0xbd, 0x9a, 0x93,   0xd7, 0xb4, 0xab,   0xcd, 0xad, 0xa9,   0xd8, 0xba, 0xbb,   0xdd, 0xc3, 0xc8,   0xdb, 0xc2, 0xc5,   0xd1, 0xb3, 0xb0,   0xcd, 0xa8, 0xa4,   0xbc, 0x92, 0x8d,   0x65, 0x4d, 0x4c,   0x21, 0x1b, 0x22,   0x2b, 0x27, 0x30,   0x27, 0x24, 0x2e,   0x54, 0x4f, 0x55,   0x75, 0x6f, 0x74,   0x6a, 0x65, 0x69,   0x61, 0x5d, 0x5f,   0x5c, 0x59, 0x57,   0x5c, 0x59, 0x56,   0x5a, 0x57, 0x53,   0x56, 0x54, 0x4f,   0x68, 0x65, 0x60,   0x75, 0x70, 0x6c,   0x6f, 0x6a, 0x66,   0x71, 0x6c, 0x69,   0x73, 0x6e, 0x6b,   0x7a, 0x76, 0x73,   0x7f, 0x7c, 0x79,   0x7d, 0x79, 0x76,   0x74, 0x71, 0x6e,   0x72, 0x6e, 0x6b,   0x6f, 0x6c, 0x69,
+	0x54, 0x54, 0x56,   0x5e, 0x5e, 0x5e,   0x63, 0x62, 0x60,   0x5d, 0x5c, 0x5a,   0x4b, 0x49, 0x4c,   0x46, 0x44, 0x48,   0x0b, 0x09, 0x0c,   0x44, 0x2f, 0x2e,   0xba, 0x94, 0x8b,   0xcc, 0xaa, 0xa3,   0xce, 0xb0, 0xab,   0xd4, 0xb6, 0xb6,   0xdf, 0xc1, 0xc6,   0xe6, 0xc9, 0xcc,   0xdf, 0xc1, 0xbf,   0xcf, 0xae, 0xa9,   0xc4, 0x9b, 0x97,   0x99, 0x72, 0x6c,   0x28, 0x1e, 0x21,   0x23, 0x20, 0x27,   0x23, 0x20, 0x28,   0x36, 0x31, 0x38,   0x57, 0x53, 0x56,   0x5c, 0x59, 0x5c,   0x50, 0x4e, 0x4f,   0x54, 0x50, 0x4f,   0x57, 0x53, 0x52,   0x56, 0x54, 0x51,   0x51, 0x4f, 0x4a,   0x50, 0x4e, 0x4a,   0x4e, 0x4c, 0x47,   0x53, 0x50, 0x4c,   0x51, 0x4f, 0x4b,   0x4e, 0x4c, 0x48,   0x53, 0x4f, 0x4c,   0x55, 0x52, 0x4f,   0x5b, 0x57, 0x54,   0x52, 0x4e, 0x4c,   0x54, 0x51, 0x4f,   0x52, 0x50, 0x4d,
+	0x5a, 0x5b, 0x5d,   0x59, 0x58, 0x5b,   0x5b, 0x59, 0x5a,   0x52, 0x50, 0x50,   0x53, 0x51, 0x54,   0x56, 0x54, 0x57,   0x1e, 0x1c, 0x1f,   0x3e, 0x29, 0x29,   0xa8, 0x80, 0x78,   0xd1, 0xae, 0xa7,   0xda, 0xbc, 0xb7,   0xd4, 0xb6, 0xb5,   0xd7, 0xb8, 0xbb,   0xad, 0x9a, 0x9e,   0x82, 0x71, 0x78,   0x7d, 0x68, 0x6e,   0x95, 0x77, 0x76,   0xb4, 0x8c, 0x86,   0x3a, 0x27, 0x26,   0x10, 0x0f, 0x12,   0x1c, 0x19, 0x1e,   0x2b, 0x27, 0x2d,   0x53, 0x51, 0x54,   0x54, 0x54, 0x55,   0x49, 0x49, 0x4b,   0x4c, 0x48, 0x47,   0x4f, 0x4b, 0x4a,   0x52, 0x51, 0x4e,   0x51, 0x50, 0x4c,   0x4e, 0x4d, 0x49,   0x4d, 0x4c, 0x48,   0x53, 0x52, 0x4e,   0x52, 0x50, 0x4d,   0x4c, 0x4c, 0x48,   0x43, 0x3f, 0x3c,   0x45, 0x41, 0x3e,   0x4e, 0x4a, 0x48,   0x50, 0x4b, 0x4a,   0x54, 0x51, 0x50,   0x49, 0x48, 0x46,
+	0x58, 0x58, 0x5a,   0x58, 0x58, 0x5a,   0x5d, 0x5d, 0x60,   0x5b, 0x5b, 0x5d,   0x59, 0x59, 0x5b,   0x61, 0x5f, 0x62,   0x2c, 0x29, 0x2b,   0x28, 0x1a, 0x1a,   0x8f, 0x70, 0x6c,   0x96, 0x7d, 0x78,   0xb3, 0x95, 0x93,   0xc2, 0xa0, 0x9e,   0x8f, 0x71, 0x72,   0x55, 0x3f, 0x40,   0x7d, 0x65, 0x67,   0x90, 0x6f, 0x71,   0x83, 0x62, 0x61,   0x99, 0x75, 0x72,   0x68, 0x4d, 0x4a,   0x0d, 0x09, 0x0e,   0x2b, 0x19, 0x20,   0x61, 0x3c, 0x44,   0x4e, 0x4d, 0x4f,   0x4e, 0x4e, 0x50,   0x46, 0x45, 0x46,   0x4d, 0x4a, 0x48,   0x4e, 0x4d, 0x49,   0x49, 0x48, 0x44,   0x47, 0x47, 0x43,   0x44, 0x42, 0x3e,   0x50, 0x4c, 0x49,   0x4f, 0x4b, 0x48,   0x58, 0x54, 0x53,   0x4a, 0x48, 0x47,   0x48, 0x47, 0x45,   0x48, 0x46, 0x45,   0x4a, 0x49, 0x47,   0x52, 0x4e, 0x4b,   0x56, 0x52, 0x4f,   0x4e, 0x4a, 0x47,
+	0x61, 0x61, 0x63,   0x67, 0x67, 0x69,   0x5e, 0x5e, 0x60,   0x5e, 0x5e, 0x60,   0x5c, 0x5c, 0x5e,   0x61, 0x5f, 0x62,   0x3d, 0x39, 0x3b,   0x0f, 0x06, 0x09,   0x40, 0x30, 0x34,   0x4c, 0x3a, 0x3d,   0x55, 0x3e, 0x3f,   0xb0, 0x90, 0x90,   0x95, 0x76, 0x77,   0x60, 0x40, 0x41,   0x59, 0x47, 0x49,   0x5f, 0x4b, 0x4e,   0x71, 0x52, 0x53,   0xa7, 0x84, 0x7c,   0xbe, 0x98, 0x94,   0x3a, 0x2a, 0x2c,   0x55, 0x2d, 0x31,   0xa7, 0x6b, 0x72,   0x58, 0x54, 0x57,   0x4d, 0x4e, 0x50,   0x47, 0x46, 0x47,   0x51, 0x4e, 0x4d,   0x4a, 0x48, 0x45,   0x45, 0x43, 0x3f,   0x42, 0x40, 0x3d,   0x51, 0x4e, 0x4b,   0x51, 0x4d, 0x4a,   0x4f, 0x4b, 0x49,   0x54, 0x51, 0x50,   0x55, 0x53, 0x51,   0x44, 0x44, 0x41,   0x4c, 0x4b, 0x49,   0x51, 0x51, 0x4f,   0x52, 0x4f, 0x4d,   0x56, 0x52, 0x50,   0x53, 0x50, 0x4d,
+	0x61, 0x61, 0x63,   0x61, 0x61, 0x63,   0x5e, 0x5e, 0x60,   0x5f, 0x5f, 0x61,   0x61, 0x61, 0x63,   0x68, 0x66, 0x69,   0x63, 0x61, 0x63,   0x1d, 0x19, 0x1a,   0x44, 0x36, 0x36,   0x57, 0x45, 0x44,   0x49, 0x36, 0x34,   0x89, 0x66, 0x6b,   0xab, 0x88, 0x8c,   0x8f, 0x69, 0x6b,   0x8b, 0x63, 0x66,   0x94, 0x6a, 0x6e,   0xb4, 0x8c, 0x8b,   0xc8, 0xa1, 0x9d,   0xc5, 0x9d, 0x9c,   0x76, 0x5b, 0x58,   0x88, 0x53, 0x58,   0xaf, 0x77, 0x7d,   0x58, 0x55, 0x56,   0x50, 0x51, 0x53,   0x4e, 0x4d, 0x4e,   0x57, 0x54, 0x53,   0x54, 0x4f, 0x4f,   0x44, 0x40, 0x3d,   0x52, 0x4d, 0x4b,   0x51, 0x4d, 0x4a,   0x4e, 0x4a, 0x48,   0x5f, 0x5a, 0x5a,   0x56, 0x53, 0x52,   0x52, 0x50, 0x4e,   0x48, 0x47, 0x45,   0x4c, 0x4b, 0x49,   0x50, 0x4e, 0x4d,   0x54, 0x4f, 0x4f,   0x50, 0x4c, 0x4b,   0x4f, 0x4b, 0x4b,
+	0x68, 0x68, 0x6a,   0x67, 0x67, 0x69,   0x60, 0x60, 0x62,   0x65, 0x65, 0x67,   0x63, 0x63, 0x65,   0x5e, 0x5e, 0x60,   0x73, 0x73, 0x75,   0x4a, 0x47, 0x4a,   0x3f, 0x33, 0x33,   0x53, 0x3d, 0x39,   0x7e, 0x58, 0x57,   0xa3, 0x7a, 0x7c,   0xdd, 0xb9, 0xbc,   0xbd, 0x95, 0x96,   0xc3, 0x97, 0x9b,   0xbf, 0x95, 0x9b,   0xbe, 0x90, 0x90,   0xba, 0x8c, 0x8b,   0xb3, 0x89, 0x85,   0x97, 0x74, 0x6e,   0xce, 0x99, 0xa0,   0xb3, 0x88, 0x8e,   0x51, 0x51, 0x53,   0x4f, 0x4f, 0x52,   0x50, 0x4f, 0x50,   0x53, 0x4f, 0x4e,   0x47, 0x43, 0x42,   0x48, 0x45, 0x41,   0x4d, 0x49, 0x45,   0x51, 0x4d, 0x4a,   0x52, 0x4f, 0x4c,   0x59, 0x57, 0x56,   0x5b, 0x57, 0x56,   0x52, 0x4f, 0x4d,   0x4f, 0x4e, 0x4c,   0x54, 0x54, 0x52,   0x4e, 0x4c, 0x4a,   0x51, 0x4f, 0x4d,   0x56, 0x54, 0x53,   0x4b, 0x47, 0x46,
+	0x6b, 0x6b, 0x6d,   0x6a, 0x6a, 0x6c,   0x66, 0x66, 0x68,   0x68, 0x68, 0x6a,   0x68, 0x68, 0x6a,   0x67, 0x67, 0x69,   0x71, 0x71, 0x73,   0x6f, 0x6c, 0x70,   0x65, 0x53, 0x53,   0x80, 0x58, 0x56,   0x92, 0x63, 0x61,   0xa9, 0x7c, 0x7e,   0xdf, 0xb6, 0xb9,   0xc5, 0x92, 0x94,   0x9e, 0x61, 0x68,   0xb4, 0x83, 0x86,   0xc6, 0x96, 0x98,   0xb9, 0x89, 0x88,   0xb3, 0x8a, 0x85,   0xa8, 0x86, 0x7c,   0x94, 0x6d, 0x6d,   0x57, 0x4d, 0x50,   0x53, 0x54, 0x55,   0x53, 0x52, 0x54,   0x55, 0x54, 0x55,   0x55, 0x53, 0x51,   0x44, 0x40, 0x3f,   0x41, 0x3d, 0x3c,   0x43, 0x40, 0x3e,   0x4e, 0x4a, 0x48,   0x51, 0x4f, 0x4d,   0x54, 0x54, 0x53,   0x5a, 0x57, 0x55,   0x54, 0x52, 0x50,   0x52, 0x52, 0x4f,   0x57, 0x56, 0x54,   0x54, 0x54, 0x52,   0x5b, 0x5a, 0x58,   0x56, 0x54, 0x53,   0x51, 0x4d, 0x4c,
+	0x6d, 0x6c, 0x6e,   0x72, 0x72, 0x74,   0x66, 0x67, 0x68,   0x67, 0x67, 0x69,   0x6b, 0x69, 0x6c,   0x6c, 0x6c, 0x6e,   0x71, 0x70, 0x72,   0x7a, 0x79, 0x7c,   0x6d, 0x61, 0x60,   0x88, 0x5f, 0x5b,   0xa1, 0x6c, 0x6b,   0x76, 0x4d, 0x4c,   0x83, 0x5b, 0x5a,   0x81, 0x54, 0x58,   0xbc, 0x98, 0x9a,   0xac, 0x7d, 0x7c,   0xb1, 0x81, 0x7e,   0xbf, 0x94, 0x8f,   0xbc, 0x96, 0x8f,   0xa6, 0x84, 0x7a,   0x53, 0x3c, 0x3a,   0x41, 0x42, 0x43,   0x5c, 0x5a, 0x5d,   0x5b, 0x59, 0x5c,   0x57, 0x55, 0x57,   0x54, 0x54, 0x52,   0x4c, 0x4b, 0x49,   0x45, 0x44, 0x42,   0x39, 0x38, 0x36,   0x4a, 0x49, 0x47,   0x58, 0x57, 0x55,   0x58, 0x57, 0x55,   0x58, 0x58, 0x55,   0x55, 0x54, 0x53,   0x58, 0x56, 0x57,   0x59, 0x58, 0x56,   0x54, 0x53, 0x50,   0x59, 0x58, 0x56,   0x5f, 0x5e, 0x5c,   0x53, 0x52, 0x50,
+	0x70, 0x71, 0x73,   0x74, 0x75, 0x77,   0x6e, 0x6e, 0x70,   0x6d, 0x6d, 0x6f,   0x6c, 0x6c, 0x6e,   0x69, 0x69, 0x6b,   0x78, 0x77, 0x79,   0x75, 0x74, 0x78,   0x7c, 0x75, 0x76,   0x6e, 0x51, 0x4c,   0x96, 0x69, 0x63,   0x83, 0x5b, 0x5a,   0x5d, 0x2d, 0x34,   0x99, 0x62, 0x6e,   0xac, 0x85, 0x8d,   0xa9, 0x86, 0x86,   0xae, 0x85, 0x7d,   0xc2, 0x9a, 0x90,   0xb7, 0x97, 0x8c,   0x94, 0x75, 0x69,   0x77, 0x62, 0x5a,   0x56, 0x55, 0x57,   0x5e, 0x5d, 0x60,   0x5a, 0x59, 0x5b,   0x56, 0x53, 0x54,   0x53, 0x51, 0x50,   0x50, 0x4f, 0x4d,   0x41, 0x40, 0x3e,   0x45, 0x44, 0x42,   0x48, 0x47, 0x45,   0x56, 0x55, 0x54,   0x5a, 0x59, 0x58,   0x5e, 0x5d, 0x5a,   0x59, 0x57, 0x57,   0x55, 0x54, 0x56,   0x5a, 0x59, 0x58,   0x54, 0x53, 0x50,   0x5a, 0x59, 0x57,   0x68, 0x67, 0x64,   0x5b, 0x5a, 0x57,
+	0x74, 0x75, 0x77,   0x76, 0x77, 0x79,   0x72, 0x72, 0x74,   0x72, 0x72, 0x74,   0x70, 0x70, 0x72,   0x71, 0x71, 0x73,   0x79, 0x79, 0x7b,   0x78, 0x78, 0x7a,   0x82, 0x83, 0x83,   0x6d, 0x60, 0x5c,   0x85, 0x64, 0x5c,   0x66, 0x43, 0x43,   0x4b, 0x26, 0x2a,   0x5e, 0x42, 0x44,   0x5f, 0x38, 0x40,   0x7c, 0x47, 0x50,   0xaa, 0x80, 0x78,   0xb5, 0x8f, 0x84,   0xa0, 0x80, 0x76,   0x82, 0x63, 0x57,   0x87, 0x6a, 0x62,   0x5d, 0x59, 0x5b,   0x59, 0x5a, 0x5c,   0x56, 0x56, 0x58,   0x5d, 0x58, 0x5a,   0x50, 0x4e, 0x4d,   0x4e, 0x4d, 0x4b,   0x3f, 0x3e, 0x3c,   0x3f, 0x3e, 0x3c,   0x46, 0x44, 0x42,   0x52, 0x51, 0x51,   0x54, 0x52, 0x54,   0x5c, 0x5b, 0x59,   0x54, 0x54, 0x53,   0x57, 0x58, 0x58,   0x5a, 0x5a, 0x58,   0x56, 0x55, 0x54,   0x58, 0x57, 0x55,   0x5e, 0x5d, 0x59,   0x5c, 0x5b, 0x58,
+	0x7a, 0x7b, 0x7d,   0x7b, 0x7c, 0x7e,   0x78, 0x79, 0x7b,   0x76, 0x76, 0x78,   0x74, 0x74, 0x76,   0x74, 0x74, 0x76,   0x7d, 0x7c, 0x7e,   0x77, 0x75, 0x76,   0x84, 0x83, 0x82,   0x78, 0x75, 0x73,   0x79, 0x60, 0x5a,   0x7a, 0x54, 0x51,   0x6f, 0x34, 0x40,   0x9e, 0x59, 0x6a,   0xa4, 0x5b, 0x6e,   0xa3, 0x64, 0x6d,   0xb1, 0x89, 0x7e,   0xa3, 0x7e, 0x72,   0x86, 0x68, 0x64,   0x88, 0x6c, 0x61,   0x9f, 0x7b, 0x6d,   0x6d, 0x63, 0x67,   0x5d, 0x5e, 0x61,   0x5a, 0x5a, 0x5b,   0x59, 0x55, 0x56,   0x52, 0x4e, 0x4e,   0x55, 0x52, 0x51,   0x46, 0x45, 0x43,   0x3a, 0x39, 0x37,   0x40, 0x3f, 0x3d,   0x5a, 0x59, 0x5a,   0x53, 0x53, 0x54,   0x4d, 0x4d, 0x4f,   0x56, 0x56, 0x58,   0x58, 0x58, 0x5b,   0x5b, 0x5a, 0x5c,   0x59, 0x57, 0x56,   0x54, 0x54, 0x53,   0x65, 0x62, 0x5f,   0x67, 0x63, 0x60,
+	0x77, 0x78, 0x7a,   0x78, 0x79, 0x7b,   0x7d, 0x7e, 0x80,   0x78, 0x79, 0x7b,   0x75, 0x74, 0x76,   0x75, 0x75, 0x77,   0x78, 0x77, 0x77,   0x79, 0x78, 0x77,   0x86, 0x86, 0x84,   0x7f, 0x7f, 0x7e,   0x6f, 0x64, 0x63,   0x80, 0x5e, 0x57,   0x81, 0x53, 0x4e,   0x79, 0x46, 0x4a,   0x95, 0x67, 0x6b,   0xbd, 0x99, 0x93,   0xbb, 0x96, 0x89,   0x8f, 0x71, 0x68,   0x78, 0x5f, 0x5b,   0xa1, 0x84, 0x77,   0xad, 0x87, 0x72,   0xa4, 0xa1, 0xab,   0x81, 0x86, 0x93,   0x56, 0x54, 0x54,   0x58, 0x56, 0x59,   0x4e, 0x4b, 0x4d,   0x4b, 0x47, 0x46,   0x3f, 0x3e, 0x3c,   0x41, 0x40, 0x3e,   0x52, 0x51, 0x4f,   0x59, 0x58, 0x59,   0x50, 0x50, 0x52,   0x55, 0x55, 0x57,   0x57, 0x57, 0x59,   0x59, 0x59, 0x5b,   0x60, 0x5e, 0x61,   0x5f, 0x5d, 0x5c,   0x5c, 0x5b, 0x59,   0x66, 0x63, 0x61,   0x5f, 0x5c, 0x5a,
+	0x7a, 0x7b, 0x7d,   0x82, 0x83, 0x85,   0x7e, 0x7f, 0x81,   0x72, 0x72, 0x74,   0x71, 0x71, 0x73,   0x79, 0x79, 0x7b,   0x77, 0x77, 0x76,   0x7d, 0x7b, 0x79,   0x81, 0x81, 0x7f,   0x7f, 0x7f, 0x7e,   0x7d, 0x7f, 0x7d,   0x72, 0x66, 0x63,   0x86, 0x6a, 0x60,   0x9f, 0x7b, 0x78,   0xa6, 0x86, 0x87,   0xa3, 0x85, 0x85,   0x8a, 0x70, 0x6d,   0x6d, 0x53, 0x4f,   0x83, 0x67, 0x5f,   0xb1, 0x93, 0x81,   0xb3, 0x98, 0x8c,   0xbc, 0xc8, 0xdd,   0xb7, 0xc2, 0xdc,   0x5b, 0x58, 0x5d,   0x4c, 0x4b, 0x4c,   0x58, 0x55, 0x59,   0x4e, 0x49, 0x4b,   0x35, 0x34, 0x32,   0x3f, 0x3e, 0x3c,   0x51, 0x50, 0x4e,   0x53, 0x53, 0x53,   0x4d, 0x4d, 0x4f,   0x56, 0x56, 0x58,   0x5f, 0x5f, 0x61,   0x61, 0x61, 0x63,   0x5c, 0x5b, 0x5e,   0x5b, 0x59, 0x58,   0x62, 0x61, 0x5f,   0x65, 0x64, 0x62,   0x5c, 0x5c, 0x5a,
+	0x7f, 0x80, 0x82,   0x7f, 0x80, 0x82,   0x7d, 0x7e, 0x80,   0x7c, 0x7c, 0x7e,   0x74, 0x75, 0x77,   0x7d, 0x7d, 0x7f,   0x73, 0x71, 0x71,   0x78, 0x77, 0x75,   0x87, 0x88, 0x86,   0x81, 0x82, 0x80,   0x81, 0x81, 0x7f,   0x87, 0x86, 0x85,   0x66, 0x5f, 0x5e,   0x51, 0x42, 0x41,   0x52, 0x43, 0x44,   0x55, 0x43, 0x46,   0x5a, 0x47, 0x46,   0x70, 0x57, 0x50,   0x9d, 0x7f, 0x72,   0xaf, 0x95, 0x84,   0xb3, 0xb4, 0xc0,   0xb1, 0xc2, 0xdd,   0xc5, 0xd2, 0xeb,   0xb8, 0xbf, 0xd4,   0x7a, 0x79, 0x85,   0x54, 0x51, 0x54,   0x44, 0x41, 0x42,   0x3e, 0x3b, 0x39,   0x4b, 0x49, 0x47,   0x58, 0x57, 0x55,   0x55, 0x55, 0x54,   0x4f, 0x4f, 0x50,   0x58, 0x58, 0x59,   0x5f, 0x5f, 0x61,   0x5e, 0x5e, 0x60,   0x5a, 0x58, 0x5b,   0x5d, 0x5c, 0x5b,   0x5e, 0x5d, 0x5b,   0x65, 0x64, 0x62,   0x5d, 0x5c, 0x5a,
+	0x82, 0x83, 0x86,   0x81, 0x82, 0x85,   0x81, 0x82, 0x84,   0x7c, 0x7d, 0x7f,   0x76, 0x77, 0x7a,   0x7a, 0x7a, 0x7d,   0x72, 0x71, 0x70,   0x7a, 0x79, 0x77,   0x87, 0x86, 0x83,   0x84, 0x82, 0x80,   0x7c, 0x79, 0x78,   0x81, 0x80, 0x7f,   0x7b, 0x77, 0x76,   0x52, 0x46, 0x45,   0x46, 0x35, 0x33,   0x51, 0x3d, 0x38,   0x6a, 0x53, 0x4a,   0x8d, 0x73, 0x64,   0xa2, 0x88, 0x7c,   0xa9, 0xa8, 0xb1,   0xb4, 0xc6, 0xe1,   0xbd, 0xcb, 0xe5,   0xc3, 0xd0, 0xe8,   0xd1, 0xde, 0xf8,   0xd8, 0xe0, 0xfc,   0xbc, 0xbf, 0xd5,   0x7d, 0x7e, 0x8c,   0x42, 0x3f, 0x41,   0x3f, 0x3b, 0x39,   0x55, 0x54, 0x51,   0x58, 0x58, 0x57,   0x51, 0x51, 0x51,   0x54, 0x54, 0x56,   0x5a, 0x5a, 0x5c,   0x59, 0x59, 0x5b,   0x5a, 0x59, 0x5b,   0x5a, 0x59, 0x58,   0x5f, 0x5e, 0x5c,   0x68, 0x67, 0x64,   0x62, 0x61, 0x5f,
+	0x84, 0x85, 0x88,   0x84, 0x85, 0x86,   0x82, 0x84, 0x83,   0x7e, 0x7f, 0x7f,   0x77, 0x77, 0x77,   0x7b, 0x7c, 0x7c,   0x71, 0x71, 0x70,   0x7c, 0x7b, 0x79,   0x87, 0x86, 0x82,   0x83, 0x82, 0x7f,   0x78, 0x76, 0x75,   0x80, 0x7e, 0x7a,   0x81, 0x83, 0x85,   0x4e, 0x41, 0x43,   0x59, 0x43, 0x3f,   0x6b, 0x54, 0x4f,   0x7b, 0x63, 0x59,   0x91, 0x7a, 0x6f,   0x9b, 0x99, 0x9f,   0xa2, 0xb1, 0xca,   0xa1, 0xb3, 0xcc,   0xa9, 0xb9, 0xd3,   0xbf, 0xcc, 0xe6,   0xcb, 0xd7, 0xf0,   0xce, 0xd9, 0xf3,   0xdb, 0xe4, 0xfc,   0xdc, 0xe7, 0xfc,   0xc0, 0xc7, 0xdc,   0x98, 0x9a, 0xa7,   0x73, 0x71, 0x77,   0x54, 0x50, 0x55,   0x52, 0x4f, 0x52,   0x59, 0x57, 0x5a,   0x5f, 0x5e, 0x61,   0x5b, 0x5c, 0x5d,   0x5e, 0x5e, 0x61,   0x5c, 0x5c, 0x5d,   0x66, 0x65, 0x61,   0x6c, 0x6b, 0x66,   0x65, 0x64, 0x60,
+	0x86, 0x87, 0x85,   0x87, 0x87, 0x85,   0x84, 0x85, 0x82,   0x82, 0x80, 0x7e,   0x7e, 0x7d, 0x7b,   0x7a, 0x79, 0x77,   0x72, 0x71, 0x6f,   0x7d, 0x7c, 0x7a,   0x88, 0x88, 0x84,   0x81, 0x81, 0x7d,   0x7d, 0x7e, 0x7c,   0x96, 0x9c, 0xa4,   0x89, 0x94, 0xa5,   0x57, 0x55, 0x60,   0x58, 0x44, 0x43,   0x70, 0x57, 0x54,   0x79, 0x63, 0x5b,   0x8a, 0x88, 0x8c,   0x94, 0xa6, 0xba,   0x9b, 0xac, 0xc3,   0x9c, 0xac, 0xc4,   0xb3, 0xc1, 0xda,   0xc3, 0xcf, 0xe7,   0xc6, 0xd1, 0xe8,   0xc6, 0xd2, 0xeb,   0xcc, 0xd7, 0xef,   0xcf, 0xdc, 0xf1,   0xdb, 0xe4, 0xfc,   0xdf, 0xe9, 0xfc,   0xd0, 0xda, 0xef,   0xac, 0xb1, 0xc3,   0x6c, 0x6d, 0x76,   0x57, 0x55, 0x58,   0x5f, 0x5b, 0x60,   0x5c, 0x5b, 0x5d,   0x65, 0x64, 0x67,   0x61, 0x60, 0x62,   0x69, 0x68, 0x65,   0x6f, 0x6e, 0x6a,   0x6a, 0x69, 0x65,
+	0x88, 0x88, 0x86,   0x88, 0x88, 0x86,   0x87, 0x87, 0x85,   0x84, 0x83, 0x81,   0x7c, 0x7b, 0x79,   0x7a, 0x79, 0x77,   0x76, 0x76, 0x74,   0x7f, 0x7d, 0x7b,   0x88, 0x87, 0x85,   0x7e, 0x81, 0x81,   0xa1, 0xa7, 0xb4,   0xa4, 0xae, 0xc4,   0x8b, 0x97, 0xaa,   0x7b, 0x83, 0x94,   0x56, 0x51, 0x52,   0x5a, 0x4a, 0x49,   0x73, 0x77, 0x81,   0x7f, 0x92, 0xa2,   0x83, 0x94, 0xa4,   0x8c, 0x9c, 0xac,   0xb1, 0xbf, 0xd1,   0xc0, 0xc9, 0xde,   0xc9, 0xd2, 0xe6,   0xc7, 0xd3, 0xe7,   0xc1, 0xce, 0xe2,   0xc5, 0xd2, 0xe7,   0xc9, 0xd4, 0xea,   0xcd, 0xd9, 0xed,   0xcf, 0xda, 0xed,   0xd2, 0xdd, 0xf2,   0xda, 0xe7, 0xfc,   0xcf, 0xdb, 0xf3,   0x97, 0x9f, 0xb2,   0x77, 0x77, 0x89,   0x60, 0x5d, 0x61,   0x66, 0x64, 0x65,   0x63, 0x61, 0x63,   0x6d, 0x6c, 0x69,   0x70, 0x6f, 0x6b,   0x6a, 0x69, 0x65,
+	0x8a, 0x8a, 0x88,   0x89, 0x8a, 0x88,   0x87, 0x89, 0x86,   0x86, 0x86, 0x84,   0x79, 0x79, 0x77,   0x79, 0x78, 0x76,   0x79, 0x78, 0x76,   0x81, 0x80, 0x7e,   0x87, 0x87, 0x87,   0x97, 0x9d, 0xa9,   0xab, 0xb4, 0xcb,   0x9b, 0xa6, 0xb8,   0x92, 0x9c, 0xaf,   0x92, 0x9b, 0xad,   0x6d, 0x73, 0x7f,   0x7b, 0x82, 0x8f,   0x88, 0x9c, 0xb0,   0x86, 0x97, 0xa9,   0x99, 0xa8, 0xb7,   0xae, 0xbc, 0xc8,   0xbb, 0xc6, 0xd2,   0xc6, 0xcc, 0xdf,   0xc2, 0xca, 0xde,   0xc2, 0xcd, 0xdf,   0xba, 0xc8, 0xda,   0xc1, 0xcf, 0xe4,   0xc7, 0xd3, 0xe9,   0xc7, 0xd3, 0xe6,   0xc9, 0xd3, 0xe7,   0xcf, 0xda, 0xf0,   0xcf, 0xda, 0xf0,   0xcf, 0xdb, 0xf4,   0xca, 0xd9, 0xf6,   0xb3, 0xc0, 0xe0,   0x77, 0x79, 0x83,   0x64, 0x62, 0x60,   0x6c, 0x6a, 0x68,   0x72, 0x6e, 0x6b,   0x71, 0x6d, 0x6a,   0x6e, 0x6a, 0x67,
+	0x8a, 0x8a, 0x88,   0x8a, 0x8b, 0x89,   0x86, 0x88, 0x85,   0x85, 0x86, 0x84,   0x7b, 0x7a, 0x78,   0x7b, 0x7a, 0x78,   0x79, 0x78, 0x77,   0x84, 0x82, 0x7f,   0x8a, 0x8b, 0x8c,   0x9b, 0xa5, 0xb4,   0x9a, 0xa6, 0xb8,   0x97, 0xa3, 0xb5,   0x9e, 0xa8, 0xbb,   0x88, 0x90, 0xa3,   0x4c, 0x54, 0x62,   0x9a, 0xa7, 0xb7,   0xad, 0xbb, 0xd1,   0xa8, 0xb8, 0xca,   0xb8, 0xc6, 0xd2,   0xb6, 0xc0, 0xcc,   0xbb, 0xc2, 0xd0,   0xb9, 0xc1, 0xd3,   0xbc, 0xc3, 0xd6,   0xc0, 0xc7, 0xda,   0xb6, 0xc1, 0xd4,   0xba, 0xc5, 0xdb,   0xbf, 0xcb, 0xe1,   0xc4, 0xcf, 0xe5,   0xc7, 0xd2, 0xe7,   0xc8, 0xd3, 0xe9,   0xc5, 0xd1, 0xe7,   0xc8, 0xd4, 0xec,   0xc8, 0xd5, 0xf0,   0xcf, 0xdd, 0xfa,   0xb0, 0xb8, 0xcc,   0x69, 0x68, 0x6a,   0x6a, 0x68, 0x65,   0x72, 0x6e, 0x6b,   0x72, 0x6e, 0x6b,   0x6e, 0x6b, 0x68,
+	0x89, 0x8c, 0x88,   0x89, 0x8b, 0x88,   0x8b, 0x8b, 0x89,   0x85, 0x85, 0x83,   0x7b, 0x7a, 0x78,   0x7a, 0x79, 0x76,   0x7f, 0x7e, 0x7d,   0x88, 0x87, 0x82,   0x89, 0x89, 0x87,   0x8f, 0x98, 0xa6,   0x9c, 0xa6, 0xb8,   0x9d, 0xa8, 0xbb,   0x96, 0x9f, 0xb4,   0x4a, 0x51, 0x61,   0x6a, 0x71, 0x86,   0x88, 0x91, 0xa7,   0xaf, 0xb9, 0xcf,   0xaf, 0xba, 0xcb,   0xab, 0xb4, 0xc2,   0xaa, 0xb0, 0xc1,   0xb5, 0xbd, 0xce,   0xb7, 0xc0, 0xd1,   0xb4, 0xbf, 0xd1,   0xba, 0xc5, 0xd9,   0xb5, 0xc0, 0xd7,   0xb6, 0xc1, 0xd8,   0xb6, 0xc1, 0xd7,   0xba, 0xc5, 0xdb,   0xbb, 0xc6, 0xdc,   0xb9, 0xc4, 0xda,   0xba, 0xc5, 0xdc,   0xbb, 0xc7, 0xdf,   0xc3, 0xd0, 0xeb,   0xc5, 0xd4, 0xee,   0xd0, 0xdd, 0xf8,   0xae, 0xb2, 0xc4,   0x6a, 0x67, 0x68,   0x6d, 0x69, 0x65,   0x73, 0x6f, 0x6d,   0x72, 0x70, 0x6d,
+	0x8b, 0x8c, 0x8a,   0x8e, 0x8e, 0x8c,   0x91, 0x91, 0x8f,   0x88, 0x8a, 0x88,   0x7e, 0x7f, 0x7c,   0x7e, 0x7d, 0x7b,   0x82, 0x81, 0x7f,   0x89, 0x88, 0x86,   0x8d, 0x8d, 0x8b,   0x8d, 0x95, 0xa5,   0x9c, 0xa8, 0xbb,   0xa2, 0xb0, 0xc2,   0x85, 0x93, 0xa7,   0x70, 0x79, 0x89,   0xa0, 0xa8, 0xba,   0x96, 0xa0, 0xb8,   0x92, 0x9c, 0xb0,   0xc4, 0xcd, 0xd6,   0xa0, 0xa8, 0xb8,   0xab, 0xb3, 0xc7,   0xb7, 0xbf, 0xd3,   0xb8, 0xc1, 0xd5,   0xb4, 0xc0, 0xd4,   0xba, 0xc6, 0xdc,   0xb5, 0xc0, 0xd7,   0xb4, 0xbe, 0xd5,   0xae, 0xb9, 0xce,   0xa8, 0xb2, 0xc8,   0xa8, 0xb3, 0xc9,   0xa7, 0xb2, 0xc8,   0xab, 0xba, 0xcf,   0xb4, 0xc2, 0xd8,   0xa9, 0xb7, 0xd1,   0x9b, 0xa8, 0xc3,   0x9f, 0xad, 0xc6,   0xc0, 0xcc, 0xe8,   0xa4, 0xa8, 0xb8,   0x73, 0x6f, 0x6c,   0x7c, 0x77, 0x72,   0x76, 0x76, 0x71,
+	0x8d, 0x8d, 0x8b,   0x8e, 0x8e, 0x8c,   0x95, 0x95, 0x93,   0x8c, 0x8e, 0x8b,   0x81, 0x83, 0x80,   0x81, 0x80, 0x7e,   0x82, 0x81, 0x7f,   0x89, 0x88, 0x86,   0x87, 0x86, 0x85,   0x8a, 0x91, 0xa2,   0xa0, 0xab, 0xc0,   0x9f, 0xad, 0xc0,   0x94, 0xa3, 0xb6,   0x91, 0x9a, 0xaf,   0x9e, 0xa7, 0xbc,   0x9f, 0xaa, 0xc0,   0x97, 0xa1, 0xb5,   0x9e, 0xa6, 0xb1,   0xa2, 0xaa, 0xbd,   0xb2, 0xbb, 0xd1,   0xb5, 0xbe, 0xd3,   0xb7, 0xc2, 0xd6,   0xb4, 0xbf, 0xd4,   0xba, 0xc5, 0xdb,   0xb3, 0xbe, 0xd4,   0xac, 0xb7, 0xcd,   0xae, 0xb9, 0xce,   0xa4, 0xac, 0xc3,   0x9a, 0xa5, 0xbb,   0x99, 0xa5, 0xbb,   0xa4, 0xb1, 0xc7,   0x9f, 0xad, 0xc2,   0xab, 0xb9, 0xd3,   0xae, 0xbb, 0xd5,   0x9c, 0xa6, 0xc0,   0x91, 0x9e, 0xb8,   0xa9, 0xb6, 0xd3,   0xa7, 0xad, 0xbe,   0x89, 0x89, 0x87,   0x76, 0x75, 0x6e,
+	0x8e, 0x8e, 0x8c,   0x91, 0x91, 0x8f,   0x94, 0x94, 0x92,   0x91, 0x92, 0x8e,   0x86, 0x88, 0x83,   0x83, 0x81, 0x80,   0x88, 0x87, 0x85,   0x8a, 0x89, 0x87,   0x87, 0x85, 0x84,   0x84, 0x8a, 0x99,   0x9f, 0xab, 0xc1,   0x9b, 0xa8, 0xbd,   0x96, 0xa5, 0xb8,   0x99, 0xa7, 0xbc,   0xa3, 0xaa, 0xbb,   0xa5, 0xad, 0xba,   0xa2, 0xaa, 0xbf,   0x8f, 0x97, 0xab,   0xad, 0xb6, 0xcb,   0xb1, 0xbd, 0xd2,   0xb3, 0xbf, 0xd2,   0xb4, 0xc1, 0xd4,   0xb4, 0xc0, 0xd5,   0xba, 0xc5, 0xdb,   0xb5, 0xc1, 0xd9,   0xa7, 0xb2, 0xca,   0xa7, 0xb2, 0xca,   0xa7, 0xb0, 0xc7,   0x8e, 0x9b, 0xb4,   0x8f, 0x9c, 0xb5,   0xa0, 0xab, 0xc4,   0x93, 0x9f, 0xb7,   0xa9, 0xb7, 0xd2,   0xb8, 0xc4, 0xdf,   0xb9, 0xc4, 0xe0,   0xab, 0xb6, 0xd4,   0x98, 0xa7, 0xc3,   0xa9, 0xba, 0xd8,   0xaf, 0xbb, 0xd1,   0x7d, 0x7c, 0x7e,
+	0x87, 0x89, 0x86,   0x8d, 0x8f, 0x8b,   0x91, 0x92, 0x8f,   0x8c, 0x8e, 0x89,   0x85, 0x87, 0x82,   0x83, 0x84, 0x80,   0x84, 0x83, 0x80,   0x8c, 0x8b, 0x88,   0x8e, 0x8c, 0x8b,   0x82, 0x89, 0x94,   0x9d, 0xab, 0xc2,   0x9a, 0xa7, 0xbd,   0x96, 0xa3, 0xb8,   0x96, 0xa1, 0xb8,   0xae, 0xb5, 0xc1,   0xae, 0xb5, 0xbb,   0xa1, 0xa8, 0xbf,   0xae, 0xb6, 0xcc,   0xb2, 0xba, 0xd1,   0xaf, 0xba, 0xcf,   0xb5, 0xc0, 0xd5,   0xb4, 0xc0, 0xd4,   0xb3, 0xbe, 0xd4,   0xb6, 0xc1, 0xd7,   0xb0, 0xbc, 0xd4,   0xa9, 0xb5, 0xcd,   0xa3, 0xae, 0xc5,   0x9f, 0xad, 0xc4,   0x8a, 0x9a, 0xb3,   0x8a, 0x9a, 0xb4,   0x96, 0xa4, 0xbc,   0x8d, 0x99, 0xb0,   0x8e, 0x9c, 0xb6,   0xb5, 0xc3, 0xde,   0xb4, 0xc1, 0xdc,   0xb9, 0xc6, 0xe2,   0xad, 0xbb, 0xd6,   0x9c, 0xa8, 0xc3,   0x9e, 0xaa, 0xca,   0xa7, 0xb0, 0xca,
+	0x89, 0x8c, 0x86,   0x8c, 0x8e, 0x89,   0x8e, 0x90, 0x8b,   0x8a, 0x8c, 0x87,   0x81, 0x82, 0x7d,   0x84, 0x85, 0x80,   0x87, 0x86, 0x82,   0x91, 0x8f, 0x8c,   0x8e, 0x8d, 0x88,   0x8d, 0x93, 0x9b,   0x9e, 0xac, 0xc4,   0x9e, 0xa9, 0xc0,   0x97, 0xa4, 0xba,   0x96, 0xa1, 0xb6,   0xaa, 0xb3, 0xc9,   0xaa, 0xb1, 0xc6,   0xa6, 0xad, 0xc1,   0xae, 0xb6, 0xcb,   0xb0, 0xb8, 0xcf,   0xae, 0xb8, 0xce,   0xb6, 0xc2, 0xd8,   0xb2, 0xbd, 0xd4,   0xb4, 0xbf, 0xd5,   0xb6, 0xc1, 0xd7,   0xac, 0xb8, 0xd0,   0xa8, 0xb4, 0xcc,   0xa0, 0xab, 0xc3,   0x9d, 0xab, 0xc4,   0x86, 0x96, 0xb2,   0x82, 0x91, 0xad,   0x92, 0xa0, 0xbb,   0x9b, 0xa9, 0xc3,   0x7d, 0x8b, 0xa6,   0x88, 0x96, 0xb0,   0xb4, 0xc2, 0xdd,   0xb8, 0xc6, 0xe1,   0xb6, 0xc4, 0xdf,   0xb0, 0xbd, 0xd9,   0xa6, 0xb4, 0xd1,   0x9e, 0xad, 0xca,
+	0x8b, 0x8d, 0x88,   0x8c, 0x8e, 0x88,   0x8c, 0x8e, 0x89,   0x86, 0x88, 0x83,   0x83, 0x83, 0x7e,   0x8b, 0x8a, 0x86,   0x8c, 0x8b, 0x87,   0x8e, 0x8d, 0x8a,   0x8b, 0x8a, 0x85,   0x89, 0x8f, 0x95,   0x99, 0xa7, 0xc0,   0x9f, 0xa9, 0xc2,   0x98, 0xa4, 0xba,   0x9a, 0xa6, 0xbc,   0x9d, 0xa8, 0xbe,   0xa9, 0xb3, 0xc9,   0xa8, 0xb0, 0xc6,   0xac, 0xb4, 0xcb,   0xb2, 0xba, 0xd0,   0xad, 0xb6, 0xcf,   0xb4, 0xbf, 0xd7,   0xb1, 0xbd, 0xd5,   0xb1, 0xbd, 0xd4,   0xae, 0xba, 0xd2,   0xad, 0xb9, 0xd1,   0xa8, 0xb6, 0xcd,   0x9c, 0xa8, 0xc3,   0x9a, 0xa8, 0xc3,   0x88, 0x98, 0xb1,   0x6e, 0x7b, 0x9a,   0x94, 0xa3, 0xbe,   0x9a, 0xa9, 0xc3,   0x87, 0x97, 0xb1,   0x74, 0x83, 0x9e,   0x83, 0x93, 0xac,   0xb4, 0xc4, 0xde,   0xb8, 0xc7, 0xe1,   0xb1, 0xc2, 0xdb,   0xa7, 0xb6, 0xd2,   0xa3, 0xb1, 0xce,
+	0x8b, 0x8d, 0x88,   0x8b, 0x8d, 0x88,   0x8b, 0x8d, 0x88,   0x87, 0x89, 0x84,   0x8a, 0x89, 0x85,   0x8a, 0x89, 0x85,   0x89, 0x88, 0x84,   0x8e, 0x8d, 0x89,   0x8f, 0x8e, 0x89,   0x91, 0x97, 0x9c,   0x9d, 0xab, 0xc4,   0xa0, 0xab, 0xc3,   0x92, 0x9e, 0xb5,   0x9b, 0xa6, 0xbb,   0x9a, 0xa6, 0xbb,   0xa6, 0xb0, 0xc6,   0xb1, 0xb8, 0xd3,   0xaf, 0xb6, 0xd0,   0xb0, 0xb8, 0xd0,   0xae, 0xb8, 0xd1,   0xb3, 0xbd, 0xd6,   0xb2, 0xbf, 0xd7,   0xb1, 0xbd, 0xd5,   0xaa, 0xb6, 0xce,   0xa7, 0xb2, 0xca,   0xa7, 0xb3, 0xcb,   0x9e, 0xab, 0xc4,   0x93, 0xa1, 0xbb,   0x8a, 0x98, 0xb3,   0x66, 0x71, 0x8c,   0x79, 0x87, 0xa1,   0x9b, 0xa9, 0xc6,   0x8d, 0x9c, 0xba,   0x82, 0x91, 0xae,   0x69, 0x77, 0x93,   0x8f, 0x9d, 0xb8,   0xb7, 0xc7, 0xe2,   0xba, 0xca, 0xe4,   0xb8, 0xc7, 0xe4,   0xac, 0xbb, 0xd8,
+	0x8d, 0x8f, 0x8a,   0x8d, 0x8f, 0x8a,   0x8c, 0x8e, 0x89,   0x89, 0x8b, 0x86,   0x88, 0x88, 0x84,   0x87, 0x86, 0x82,   0x87, 0x86, 0x82,   0x8d, 0x8c, 0x88,   0x8b, 0x8a, 0x85,   0x88, 0x8e, 0x93,   0x99, 0xa7, 0xbc,   0xa2, 0xac, 0xc4,   0x8d, 0x99, 0xaf,   0x99, 0xa4, 0xb8,   0x9b, 0xa6, 0xbb,   0x9e, 0xa8, 0xbe,   0xae, 0xb5, 0xcf,   0xaf, 0xb7, 0xcf,   0xaf, 0xb6, 0xd0,   0xad, 0xb6, 0xd2,   0xb2, 0xbc, 0xd7,   0xb2, 0xbe, 0xd8,   0xac, 0xb8, 0xd1,   0xab, 0xb7, 0xce,   0xa8, 0xb3, 0xcc,   0xa5, 0xb1, 0xc9,   0x9a, 0xa8, 0xbf,   0x9a, 0xa7, 0xc2,   0x8a, 0x97, 0xb5,   0x69, 0x76, 0x8d,   0x5d, 0x66, 0x7b,   0x98, 0xa4, 0xbf,   0x9a, 0xa8, 0xc8,   0x88, 0x96, 0xb4,   0x74, 0x81, 0x9d,   0x68, 0x75, 0x90,   0x8f, 0xa0, 0xb8,   0xb7, 0xc7, 0xe3,   0xb6, 0xc4, 0xe3,   0xb6, 0xc5, 0xe2,
+	0x8d, 0x8f, 0x8a,   0x8f, 0x91, 0x8c,   0x8e, 0x90, 0x8b,   0x8b, 0x8d, 0x88,   0x84, 0x85, 0x80,   0x86, 0x85, 0x81,   0x87, 0x86, 0x82,   0x89, 0x89, 0x85,   0x88, 0x89, 0x83,   0x88, 0x8a, 0x8d,   0x97, 0xa1, 0xb7,   0x9f, 0xaa, 0xc2,   0x93, 0x9f, 0xb5,   0x9a, 0xa5, 0xb8,   0x95, 0xa0, 0xb7,   0x95, 0x9f, 0xb5,   0xa4, 0xad, 0xc3,   0xad, 0xb7, 0xcd,   0xae, 0xb6, 0xd1,   0xaf, 0xb8, 0xd4,   0xaf, 0xb9, 0xd5,   0xac, 0xb9, 0xd2,   0xac, 0xb8, 0xd1,   0xa3, 0xaf, 0xc8,   0xa4, 0xb2, 0xcb,   0x96, 0xa5, 0xbe,   0x90, 0x9f, 0xb8,   0x94, 0xa4, 0xbe,   0x84, 0x93, 0xae,   0x71, 0x7c, 0x92,   0x4d, 0x54, 0x64,   0x65, 0x6e, 0x83,   0x92, 0xa0, 0xbc,   0x8f, 0x9e, 0xbc,   0x7c, 0x8c, 0xa6,   0x5f, 0x6f, 0x88,   0x65, 0x75, 0x8e,   0x92, 0xa2, 0xbb,   0xb3, 0xc3, 0xdf,   0xb4, 0xc3, 0xe0,
+	0x90, 0x92, 0x8d,   0x90, 0x92, 0x8d,   0x90, 0x92, 0x8d,   0x8b, 0x8d, 0x88,   0x85, 0x86, 0x82,   0x86, 0x85, 0x81,   0x8a, 0x89, 0x85,   0x8b, 0x8a, 0x86,   0x88, 0x88, 0x82,   0x89, 0x8a, 0x8d,   0x96, 0xa0, 0xb7,   0x9c, 0xa8, 0xbf,   0x99, 0xa5, 0xbc,   0xa0, 0xaa, 0xc0,   0xa2, 0xab, 0xb7,   0x94, 0x9f, 0xb7,   0x99, 0xa5, 0xbb,   0xab, 0xb6, 0xcd,   0xa9, 0xb3, 0xce,   0xaa, 0xb7, 0xd3,   0xa7, 0xb4, 0xcf,   0x9f, 0xae, 0xc7,   0xa5, 0xb3, 0xcd,   0x9e, 0xac, 0xc7,   0x99, 0xa8, 0xc4,   0x89, 0x99, 0xb4,   0x99, 0xa8, 0xc4,   0x85, 0x94, 0xb1,   0x80, 0x8e, 0xa8,   0x78, 0x82, 0x99,   0x48, 0x4f, 0x61,   0x48, 0x4f, 0x60,   0x65, 0x6f, 0x86,   0x91, 0x9f, 0xbb,   0x7e, 0x8e, 0xa9,   0x78, 0x87, 0xa3,   0x86, 0x96, 0xb0,   0x94, 0xa4, 0xbd,   0xa4, 0xb2, 0xce,   0xb3, 0xc2, 0xdf,
+	0x97, 0x97, 0x92,   0x95, 0x94, 0x90,   0x93, 0x94, 0x8f,   0x8c, 0x8e, 0x89,   0x85, 0x86, 0x81,   0x85, 0x86, 0x81,   0x8a, 0x8a, 0x85,   0x8a, 0x8a, 0x86,   0x8a, 0x8a, 0x84,   0x88, 0x88, 0x89,   0x8d, 0x96, 0xac,   0x98, 0xa4, 0xbb,   0x93, 0x9e, 0xb7,   0x92, 0x9e, 0xb2,   0xa4, 0xad, 0xae,   0x9b, 0xa8, 0xbe,   0x9b, 0xa6, 0xbf,   0xa6, 0xb1, 0xc8,   0x98, 0xa3, 0xbc,   0xaa, 0xb7, 0xd4,   0xa0, 0xad, 0xca,   0x9f, 0xae, 0xcb,   0xa2, 0xb0, 0xcd,   0xa3, 0xb1, 0xce,   0x9d, 0xab, 0xca,   0x96, 0xa5, 0xc3,   0x8d, 0x9c, 0xbb,   0x8a, 0x9a, 0xb6,   0x7d, 0x8a, 0xa3,   0x7e, 0x89, 0x9f,   0x6b, 0x75, 0x8d,   0x45, 0x4c, 0x5f,   0x54, 0x5b, 0x69,   0x68, 0x75, 0x90,   0x8a, 0x9a, 0xb9,   0x7f, 0x8e, 0xac,   0x86, 0x95, 0xb3,   0x97, 0xa6, 0xc2,   0x9d, 0xac, 0xc8,   0xa4, 0xb2, 0xcf,
+	0x9b, 0x97, 0x94,   0x98, 0x96, 0x93,   0x92, 0x94, 0x8f,   0x8c, 0x8e, 0x89,   0x89, 0x8b, 0x86,   0x85, 0x87, 0x82,   0x87, 0x89, 0x84,   0x88, 0x8b, 0x85,   0x88, 0x8b, 0x86,   0x86, 0x88, 0x83,   0x89, 0x90, 0xa2,   0x8c, 0x98, 0xb1,   0x87, 0x92, 0xa9,   0x8e, 0x9b, 0xb2,   0x93, 0x9f, 0xb6,   0x8b, 0x96, 0xac,   0x8f, 0x9a, 0xb0,   0x9f, 0xaa, 0xc2,   0x9c, 0xa8, 0xc3,   0xa6, 0xb4, 0xd1,   0xa4, 0xb2, 0xd1,   0x9b, 0xa9, 0xc9,   0x9e, 0xac, 0xcb,   0x98, 0xa7, 0xc4,   0x93, 0xa2, 0xc0,   0x9d, 0xab, 0xcb,   0x95, 0xa4, 0xc4,   0x82, 0x92, 0xac,   0x73, 0x80, 0x98,   0x6c, 0x78, 0x8f,   0x7d, 0x8a, 0xa4,   0x61, 0x6a, 0x82,   0x42, 0x48, 0x56,   0x51, 0x59, 0x6e,   0x84, 0x94, 0xb2,   0x81, 0x8f, 0xad,   0x8c, 0x9b, 0xb7,   0x99, 0xa8, 0xc4,   0x9f, 0xad, 0xcb,   0xa3, 0xb1, 0xcf,
+	0x97, 0x97, 0x92,   0x95, 0x97, 0x92,   0x92, 0x94, 0x8f,   0x8f, 0x91, 0x8c,   0x8a, 0x8c, 0x87,   0x85, 0x87, 0x82,   0x87, 0x89, 0x84,   0x87, 0x89, 0x84,   0x88, 0x8a, 0x85,   0x8a, 0x8b, 0x85,   0x88, 0x8f, 0x9e,   0x8c, 0x99, 0xb1,   0x87, 0x93, 0xaa,   0x93, 0x9f, 0xb6,   0xa1, 0xac, 0xc4,   0x93, 0x9f, 0xb4,   0x8c, 0x9a, 0xae,   0x96, 0xa3, 0xba,   0x94, 0xa2, 0xbd,   0x9b, 0xa9, 0xc8,   0xa6, 0xb4, 0xd3,   0x9a, 0xa8, 0xc7,   0x9c, 0xaa, 0xc9,   0x96, 0xa5, 0xc4,   0x93, 0xa2, 0xc0,   0x95, 0xa3, 0xc3,   0x9d, 0xab, 0xcb,   0x83, 0x94, 0xad,   0x85, 0x94, 0xab,   0x83, 0x92, 0xab,   0x81, 0x90, 0xaa,   0x84, 0x92, 0xad,   0x55, 0x60, 0x74,   0x38, 0x3d, 0x4a,   0x69, 0x71, 0x88,   0x85, 0x91, 0xaf,   0x74, 0x81, 0x9c,   0x96, 0xa5, 0xc1,   0xa3, 0xb1, 0xcf,   0xb0, 0xbf, 0xde,
+};
 
-static const uint8_t ffrank_buffer[FFRANK_WIDTH * FFRANK_HEIGHT * 3] = {
-	0x62, 0x59, 0x56,   0x63, 0x59, 0x57,   0x78, 0x6e, 0x6c,   0x7c, 0x72, 0x6e,   0x81, 0x78, 0x73,   0x91, 0x88, 0x83,   0x8a, 0x80, 0x7c,   0x84, 0x7a, 0x76,   0xa5, 0x9c, 0x98,   0x70, 0x67, 0x67,   0x3d, 0x33, 0x38,   0x30, 0x29, 0x2f,   0x2e, 0x2a, 0x2f,   0x32, 0x2d, 0x33,   0x38, 0x32, 0x39,   0x44, 0x3c, 0x3f,   0x64, 0x59, 0x59,   0x70, 0x65, 0x66,   0x60, 0x56, 0x55,   0x65, 0x5a, 0x5a,   0x66, 0x5d, 0x5b,   0x5e, 0x56, 0x54,   0x6c, 0x65, 0x60,   0x6e, 0x67, 0x61,   0x66, 0x5d, 0x57,   0x6b, 0x62, 0x5d,   0x84, 0x7a, 0x74,   0x73, 0x6b, 0x63,   0x5d, 0x59, 0x50,   0x70, 0x68, 0x62,   0x6a, 0x62, 0x5d,   0x61, 0x5a, 0x54,   0x83, 0x7a, 0x75,   0x76, 0x6c, 0x65,   0x67, 0x5c, 0x58,   0x6e, 0x63, 0x5f,   0x75, 0x6a, 0x66,   0x6b, 0x60, 0x5c,   0x69, 0x5e, 0x5a,   0x6a, 0x5f, 0x5b,   
-	0x62, 0x5b, 0x59,   0x60, 0x58, 0x56,   0x62, 0x59, 0x57,   0x58, 0x4f, 0x4e,   0x5a, 0x52, 0x50,   0x5f, 0x57, 0x53,   0x79, 0x70, 0x6d,   0x8d, 0x85, 0x83,   0x50, 0x49, 0x4a,   0x1e, 0x17, 0x1a,   0x1b, 0x17, 0x1c,   0x1d, 0x18, 0x1f,   0x1a, 0x19, 0x1f,   0x23, 0x21, 0x26,   0x1a, 0x17, 0x1b,   0x14, 0x11, 0x13,   0x2c, 0x22, 0x26,   0x45, 0x3b, 0x3f,   0x40, 0x36, 0x3a,   0x57, 0x4e, 0x4e,   0x76, 0x6d, 0x6b,   0x6e, 0x66, 0x63,   0x65, 0x5e, 0x5a,   0x59, 0x52, 0x4f,   0x6b, 0x62, 0x5f,   0x69, 0x60, 0x5c,   0x76, 0x6d, 0x67,   0x6c, 0x64, 0x5d,   0x60, 0x5b, 0x54,   0x66, 0x60, 0x59,   0x64, 0x5d, 0x57,   0x60, 0x58, 0x53,   0x67, 0x5e, 0x59,   0x76, 0x6c, 0x66,   0x7a, 0x6e, 0x6a,   0x7d, 0x72, 0x6e,   0x7f, 0x74, 0x70,   0x6b, 0x60, 0x5c,   0x70, 0x65, 0x61,   0x6a, 0x5f, 0x5b,   
-	0x4a, 0x44, 0x44,   0x4d, 0x45, 0x46,   0x55, 0x4d, 0x4f,   0x57, 0x4f, 0x50,   0x40, 0x37, 0x38,   0x52, 0x49, 0x48,   0x63, 0x5e, 0x5d,   0x37, 0x33, 0x33,   0x0f, 0x09, 0x0b,   0x11, 0x0e, 0x11,   0x20, 0x1c, 0x1f,   0x33, 0x2a, 0x2d,   0x5a, 0x4d, 0x50,   0x66, 0x54, 0x55,   0x55, 0x40, 0x41,   0x30, 0x20, 0x22,   0x14, 0x0d, 0x0f,   0x0f, 0x0b, 0x0d,   0x17, 0x11, 0x16,   0x3d, 0x37, 0x3c,   0x63, 0x5a, 0x5b,   0x60, 0x58, 0x54,   0x4c, 0x44, 0x42,   0x3c, 0x33, 0x32,   0x60, 0x56, 0x55,   0x6a, 0x60, 0x5d,   0x6c, 0x64, 0x5f,   0x61, 0x5b, 0x55,   0x6a, 0x63, 0x5e,   0x6f, 0x68, 0x62,   0x72, 0x69, 0x64,   0x7c, 0x72, 0x6d,   0x85, 0x7c, 0x77,   0x70, 0x67, 0x62,   0x7f, 0x74, 0x6e,   0x85, 0x7a, 0x74,   0x83, 0x78, 0x72,   0x7a, 0x6f, 0x6b,   0x64, 0x59, 0x55,   0x7d, 0x71, 0x6d,   
-	0x54, 0x53, 0x54,   0x5b, 0x57, 0x58,   0x54, 0x4f, 0x4f,   0x4d, 0x47, 0x48,   0x4f, 0x49, 0x4c,   0x52, 0x4c, 0x50,   0x4c, 0x49, 0x4b,   0x10, 0x0c, 0x0d,   0x14, 0x0d, 0x0f,   0x4a, 0x38, 0x3a,   0x79, 0x5f, 0x61,   0xad, 0x93, 0x95,   0xe0, 0xc8, 0xcb,   0xe1, 0xc7, 0xc8,   0xd3, 0xb5, 0xb5,   0xb1, 0x91, 0x90,   0x5b, 0x46, 0x43,   0x1a, 0x13, 0x15,   0x20, 0x1a, 0x21,   0x22, 0x1d, 0x25,   0x32, 0x2d, 0x33,   0x6e, 0x66, 0x66,   0x62, 0x59, 0x57,   0x61, 0x58, 0x57,   0x77, 0x6e, 0x6b,   0x6f, 0x66, 0x60,   0x64, 0x5c, 0x56,   0x69, 0x61, 0x5b,   0x6c, 0x65, 0x5e,   0x70, 0x69, 0x62,   0x79, 0x70, 0x6b,   0x80, 0x77, 0x71,   0x82, 0x78, 0x75,   0x88, 0x7e, 0x7a,   0x8b, 0x80, 0x7b,   0x7f, 0x74, 0x6e,   0x7f, 0x75, 0x6f,   0x8e, 0x83, 0x7f,   0x8d, 0x81, 0x7d,   0x88, 0x7d, 0x77,   
-	0x8b, 0x8c, 0x8f,   0x92, 0x91, 0x94,   0x82, 0x80, 0x82,   0x7b, 0x78, 0x7b,   0x81, 0x7e, 0x84,   0x89, 0x87, 0x8e,   0x3c, 0x3b, 0x3e,   0x03, 0x01, 0x02,   0x65, 0x4f, 0x4d,   0xd1, 0xab, 0xa5,   0xe1, 0xbe, 0xbc,   0xea, 0xcf, 0xce,   0xe6, 0xd0, 0xd4,   0xe4, 0xcc, 0xd0,   0xdd, 0xc2, 0xc2,   0xd4, 0xb3, 0xaf,   0xa0, 0x7e, 0x79,   0x37, 0x29, 0x2b,   0x20, 0x1a, 0x21,   0x21, 0x1c, 0x24,   0x29, 0x25, 0x2c,   0x66, 0x62, 0x66,   0x66, 0x60, 0x62,   0x5e, 0x59, 0x5b,   0x6e, 0x67, 0x67,   0x63, 0x5c, 0x59,   0x55, 0x50, 0x4c,   0x5d, 0x57, 0x53,   0x59, 0x54, 0x4f,   0x6a, 0x66, 0x60,   0x77, 0x71, 0x6d,   0x6e, 0x68, 0x65,   0x79, 0x72, 0x70,   0x7f, 0x78, 0x77,   0x81, 0x7a, 0x76,   0x81, 0x79, 0x75,   0x7d, 0x76, 0x72,   0x7a, 0x73, 0x6f,   0x79, 0x71, 0x6d,   0x78, 0x71, 0x6e,   
-	0x67, 0x67, 0x69,   0x6e, 0x6e, 0x6f,   0x76, 0x76, 0x77,   0x79, 0x78, 0x79,   0x65, 0x63, 0x68,   0x6a, 0x68, 0x6d,   0x18, 0x19, 0x1b,   0x20, 0x15, 0x16,   0xbd, 0x9a, 0x93,   0xd7, 0xb4, 0xab,   0xcd, 0xad, 0xa9,   0xd8, 0xba, 0xbb,   0xdd, 0xc3, 0xc8,   0xdb, 0xc2, 0xc5,   0xd1, 0xb3, 0xb0,   0xcd, 0xa8, 0xa4,   0xbc, 0x92, 0x8d,   0x65, 0x4d, 0x4c,   0x21, 0x1b, 0x22,   0x2b, 0x27, 0x30,   0x27, 0x24, 0x2e,   0x54, 0x4f, 0x55,   0x75, 0x6f, 0x74,   0x6a, 0x65, 0x69,   0x61, 0x5d, 0x5f,   0x5c, 0x59, 0x57,   0x5c, 0x59, 0x56,   0x5a, 0x57, 0x53,   0x56, 0x54, 0x4f,   0x68, 0x65, 0x60,   0x75, 0x70, 0x6c,   0x6f, 0x6a, 0x66,   0x71, 0x6c, 0x69,   0x73, 0x6e, 0x6b,   0x7a, 0x76, 0x73,   0x7f, 0x7c, 0x79,   0x7d, 0x79, 0x76,   0x74, 0x71, 0x6e,   0x72, 0x6e, 0x6b,   0x6f, 0x6c, 0x69,   
-	0x54, 0x54, 0x56,   0x5e, 0x5e, 0x5e,   0x63, 0x62, 0x60,   0x5d, 0x5c, 0x5a,   0x4b, 0x49, 0x4c,   0x46, 0x44, 0x48,   0x0b, 0x09, 0x0c,   0x44, 0x2f, 0x2e,   0xba, 0x94, 0x8b,   0xcc, 0xaa, 0xa3,   0xce, 0xb0, 0xab,   0xd4, 0xb6, 0xb6,   0xdf, 0xc1, 0xc6,   0xe6, 0xc9, 0xcc,   0xdf, 0xc1, 0xbf,   0xcf, 0xae, 0xa9,   0xc4, 0x9b, 0x97,   0x99, 0x72, 0x6c,   0x28, 0x1e, 0x21,   0x23, 0x20, 0x27,   0x23, 0x20, 0x28,   0x36, 0x31, 0x38,   0x57, 0x53, 0x56,   0x5c, 0x59, 0x5c,   0x50, 0x4e, 0x4f,   0x54, 0x50, 0x4f,   0x57, 0x53, 0x52,   0x56, 0x54, 0x51,   0x51, 0x4f, 0x4a,   0x50, 0x4e, 0x4a,   0x4e, 0x4c, 0x47,   0x53, 0x50, 0x4c,   0x51, 0x4f, 0x4b,   0x4e, 0x4c, 0x48,   0x53, 0x4f, 0x4c,   0x55, 0x52, 0x4f,   0x5b, 0x57, 0x54,   0x52, 0x4e, 0x4c,   0x54, 0x51, 0x4f,   0x52, 0x50, 0x4d,   
-	0x5a, 0x5b, 0x5d,   0x59, 0x58, 0x5b,   0x5b, 0x59, 0x5a,   0x52, 0x50, 0x50,   0x53, 0x51, 0x54,   0x56, 0x54, 0x57,   0x1e, 0x1c, 0x1f,   0x3e, 0x29, 0x29,   0xa8, 0x80, 0x78,   0xd1, 0xae, 0xa7,   0xda, 0xbc, 0xb7,   0xd4, 0xb6, 0xb5,   0xd7, 0xb8, 0xbb,   0xad, 0x9a, 0x9e,   0x82, 0x71, 0x78,   0x7d, 0x68, 0x6e,   0x95, 0x77, 0x76,   0xb4, 0x8c, 0x86,   0x3a, 0x27, 0x26,   0x10, 0x0f, 0x12,   0x1c, 0x19, 0x1e,   0x2b, 0x27, 0x2d,   0x53, 0x51, 0x54,   0x54, 0x54, 0x55,   0x49, 0x49, 0x4b,   0x4c, 0x48, 0x47,   0x4f, 0x4b, 0x4a,   0x52, 0x51, 0x4e,   0x51, 0x50, 0x4c,   0x4e, 0x4d, 0x49,   0x4d, 0x4c, 0x48,   0x53, 0x52, 0x4e,   0x52, 0x50, 0x4d,   0x4c, 0x4c, 0x48,   0x43, 0x3f, 0x3c,   0x45, 0x41, 0x3e,   0x4e, 0x4a, 0x48,   0x50, 0x4b, 0x4a,   0x54, 0x51, 0x50,   0x49, 0x48, 0x46,   
-	0x58, 0x58, 0x5a,   0x58, 0x58, 0x5a,   0x5d, 0x5d, 0x60,   0x5b, 0x5b, 0x5d,   0x59, 0x59, 0x5b,   0x61, 0x5f, 0x62,   0x2c, 0x29, 0x2b,   0x28, 0x1a, 0x1a,   0x8f, 0x70, 0x6c,   0x96, 0x7d, 0x78,   0xb3, 0x95, 0x93,   0xc2, 0xa0, 0x9e,   0x8f, 0x71, 0x72,   0x55, 0x3f, 0x40,   0x7d, 0x65, 0x67,   0x90, 0x6f, 0x71,   0x83, 0x62, 0x61,   0x99, 0x75, 0x72,   0x68, 0x4d, 0x4a,   0x0d, 0x09, 0x0e,   0x2b, 0x19, 0x20,   0x61, 0x3c, 0x44,   0x4e, 0x4d, 0x4f,   0x4e, 0x4e, 0x50,   0x46, 0x45, 0x46,   0x4d, 0x4a, 0x48,   0x4e, 0x4d, 0x49,   0x49, 0x48, 0x44,   0x47, 0x47, 0x43,   0x44, 0x42, 0x3e,   0x50, 0x4c, 0x49,   0x4f, 0x4b, 0x48,   0x58, 0x54, 0x53,   0x4a, 0x48, 0x47,   0x48, 0x47, 0x45,   0x48, 0x46, 0x45,   0x4a, 0x49, 0x47,   0x52, 0x4e, 0x4b,   0x56, 0x52, 0x4f,   0x4e, 0x4a, 0x47,   
-	0x61, 0x61, 0x63,   0x67, 0x67, 0x69,   0x5e, 0x5e, 0x60,   0x5e, 0x5e, 0x60,   0x5c, 0x5c, 0x5e,   0x61, 0x5f, 0x62,   0x3d, 0x39, 0x3b,   0x0f, 0x06, 0x09,   0x40, 0x30, 0x34,   0x4c, 0x3a, 0x3d,   0x55, 0x3e, 0x3f,   0xb0, 0x90, 0x90,   0x95, 0x76, 0x77,   0x60, 0x40, 0x41,   0x59, 0x47, 0x49,   0x5f, 0x4b, 0x4e,   0x71, 0x52, 0x53,   0xa7, 0x84, 0x7c,   0xbe, 0x98, 0x94,   0x3a, 0x2a, 0x2c,   0x55, 0x2d, 0x31,   0xa7, 0x6b, 0x72,   0x58, 0x54, 0x57,   0x4d, 0x4e, 0x50,   0x47, 0x46, 0x47,   0x51, 0x4e, 0x4d,   0x4a, 0x48, 0x45,   0x45, 0x43, 0x3f,   0x42, 0x40, 0x3d,   0x51, 0x4e, 0x4b,   0x51, 0x4d, 0x4a,   0x4f, 0x4b, 0x49,   0x54, 0x51, 0x50,   0x55, 0x53, 0x51,   0x44, 0x44, 0x41,   0x4c, 0x4b, 0x49,   0x51, 0x51, 0x4f,   0x52, 0x4f, 0x4d,   0x56, 0x52, 0x50,   0x53, 0x50, 0x4d,   
-	0x61, 0x61, 0x63,   0x61, 0x61, 0x63,   0x5e, 0x5e, 0x60,   0x5f, 0x5f, 0x61,   0x61, 0x61, 0x63,   0x68, 0x66, 0x69,   0x63, 0x61, 0x63,   0x1d, 0x19, 0x1a,   0x44, 0x36, 0x36,   0x57, 0x45, 0x44,   0x49, 0x36, 0x34,   0x89, 0x66, 0x6b,   0xab, 0x88, 0x8c,   0x8f, 0x69, 0x6b,   0x8b, 0x63, 0x66,   0x94, 0x6a, 0x6e,   0xb4, 0x8c, 0x8b,   0xc8, 0xa1, 0x9d,   0xc5, 0x9d, 0x9c,   0x76, 0x5b, 0x58,   0x88, 0x53, 0x58,   0xaf, 0x77, 0x7d,   0x58, 0x55, 0x56,   0x50, 0x51, 0x53,   0x4e, 0x4d, 0x4e,   0x57, 0x54, 0x53,   0x54, 0x4f, 0x4f,   0x44, 0x40, 0x3d,   0x52, 0x4d, 0x4b,   0x51, 0x4d, 0x4a,   0x4e, 0x4a, 0x48,   0x5f, 0x5a, 0x5a,   0x56, 0x53, 0x52,   0x52, 0x50, 0x4e,   0x48, 0x47, 0x45,   0x4c, 0x4b, 0x49,   0x50, 0x4e, 0x4d,   0x54, 0x4f, 0x4f,   0x50, 0x4c, 0x4b,   0x4f, 0x4b, 0x4b,   
-	0x68, 0x68, 0x6a,   0x67, 0x67, 0x69,   0x60, 0x60, 0x62,   0x65, 0x65, 0x67,   0x63, 0x63, 0x65,   0x5e, 0x5e, 0x60,   0x73, 0x73, 0x75,   0x4a, 0x47, 0x4a,   0x3f, 0x33, 0x33,   0x53, 0x3d, 0x39,   0x7e, 0x58, 0x57,   0xa3, 0x7a, 0x7c,   0xdd, 0xb9, 0xbc,   0xbd, 0x95, 0x96,   0xc3, 0x97, 0x9b,   0xbf, 0x95, 0x9b,   0xbe, 0x90, 0x90,   0xba, 0x8c, 0x8b,   0xb3, 0x89, 0x85,   0x97, 0x74, 0x6e,   0xce, 0x99, 0xa0,   0xb3, 0x88, 0x8e,   0x51, 0x51, 0x53,   0x4f, 0x4f, 0x52,   0x50, 0x4f, 0x50,   0x53, 0x4f, 0x4e,   0x47, 0x43, 0x42,   0x48, 0x45, 0x41,   0x4d, 0x49, 0x45,   0x51, 0x4d, 0x4a,   0x52, 0x4f, 0x4c,   0x59, 0x57, 0x56,   0x5b, 0x57, 0x56,   0x52, 0x4f, 0x4d,   0x4f, 0x4e, 0x4c,   0x54, 0x54, 0x52,   0x4e, 0x4c, 0x4a,   0x51, 0x4f, 0x4d,   0x56, 0x54, 0x53,   0x4b, 0x47, 0x46,   
-	0x6b, 0x6b, 0x6d,   0x6a, 0x6a, 0x6c,   0x66, 0x66, 0x68,   0x68, 0x68, 0x6a,   0x68, 0x68, 0x6a,   0x67, 0x67, 0x69,   0x71, 0x71, 0x73,   0x6f, 0x6c, 0x70,   0x65, 0x53, 0x53,   0x80, 0x58, 0x56,   0x92, 0x63, 0x61,   0xa9, 0x7c, 0x7e,   0xdf, 0xb6, 0xb9,   0xc5, 0x92, 0x94,   0x9e, 0x61, 0x68,   0xb4, 0x83, 0x86,   0xc6, 0x96, 0x98,   0xb9, 0x89, 0x88,   0xb3, 0x8a, 0x85,   0xa8, 0x86, 0x7c,   0x94, 0x6d, 0x6d,   0x57, 0x4d, 0x50,   0x53, 0x54, 0x55,   0x53, 0x52, 0x54,   0x55, 0x54, 0x55,   0x55, 0x53, 0x51,   0x44, 0x40, 0x3f,   0x41, 0x3d, 0x3c,   0x43, 0x40, 0x3e,   0x4e, 0x4a, 0x48,   0x51, 0x4f, 0x4d,   0x54, 0x54, 0x53,   0x5a, 0x57, 0x55,   0x54, 0x52, 0x50,   0x52, 0x52, 0x4f,   0x57, 0x56, 0x54,   0x54, 0x54, 0x52,   0x5b, 0x5a, 0x58,   0x56, 0x54, 0x53,   0x51, 0x4d, 0x4c,   
-	0x6d, 0x6c, 0x6e,   0x72, 0x72, 0x74,   0x66, 0x67, 0x68,   0x67, 0x67, 0x69,   0x6b, 0x69, 0x6c,   0x6c, 0x6c, 0x6e,   0x71, 0x70, 0x72,   0x7a, 0x79, 0x7c,   0x6d, 0x61, 0x60,   0x88, 0x5f, 0x5b,   0xa1, 0x6c, 0x6b,   0x76, 0x4d, 0x4c,   0x83, 0x5b, 0x5a,   0x81, 0x54, 0x58,   0xbc, 0x98, 0x9a,   0xac, 0x7d, 0x7c,   0xb1, 0x81, 0x7e,   0xbf, 0x94, 0x8f,   0xbc, 0x96, 0x8f,   0xa6, 0x84, 0x7a,   0x53, 0x3c, 0x3a,   0x41, 0x42, 0x43,   0x5c, 0x5a, 0x5d,   0x5b, 0x59, 0x5c,   0x57, 0x55, 0x57,   0x54, 0x54, 0x52,   0x4c, 0x4b, 0x49,   0x45, 0x44, 0x42,   0x39, 0x38, 0x36,   0x4a, 0x49, 0x47,   0x58, 0x57, 0x55,   0x58, 0x57, 0x55,   0x58, 0x58, 0x55,   0x55, 0x54, 0x53,   0x58, 0x56, 0x57,   0x59, 0x58, 0x56,   0x54, 0x53, 0x50,   0x59, 0x58, 0x56,   0x5f, 0x5e, 0x5c,   0x53, 0x52, 0x50,   
-	0x70, 0x71, 0x73,   0x74, 0x75, 0x77,   0x6e, 0x6e, 0x70,   0x6d, 0x6d, 0x6f,   0x6c, 0x6c, 0x6e,   0x69, 0x69, 0x6b,   0x78, 0x77, 0x79,   0x75, 0x74, 0x78,   0x7c, 0x75, 0x76,   0x6e, 0x51, 0x4c,   0x96, 0x69, 0x63,   0x83, 0x5b, 0x5a,   0x5d, 0x2d, 0x34,   0x99, 0x62, 0x6e,   0xac, 0x85, 0x8d,   0xa9, 0x86, 0x86,   0xae, 0x85, 0x7d,   0xc2, 0x9a, 0x90,   0xb7, 0x97, 0x8c,   0x94, 0x75, 0x69,   0x77, 0x62, 0x5a,   0x56, 0x55, 0x57,   0x5e, 0x5d, 0x60,   0x5a, 0x59, 0x5b,   0x56, 0x53, 0x54,   0x53, 0x51, 0x50,   0x50, 0x4f, 0x4d,   0x41, 0x40, 0x3e,   0x45, 0x44, 0x42,   0x48, 0x47, 0x45,   0x56, 0x55, 0x54,   0x5a, 0x59, 0x58,   0x5e, 0x5d, 0x5a,   0x59, 0x57, 0x57,   0x55, 0x54, 0x56,   0x5a, 0x59, 0x58,   0x54, 0x53, 0x50,   0x5a, 0x59, 0x57,   0x68, 0x67, 0x64,   0x5b, 0x5a, 0x57,   
-	0x74, 0x75, 0x77,   0x76, 0x77, 0x79,   0x72, 0x72, 0x74,   0x72, 0x72, 0x74,   0x70, 0x70, 0x72,   0x71, 0x71, 0x73,   0x79, 0x79, 0x7b,   0x78, 0x78, 0x7a,   0x82, 0x83, 0x83,   0x6d, 0x60, 0x5c,   0x85, 0x64, 0x5c,   0x66, 0x43, 0x43,   0x4b, 0x26, 0x2a,   0x5e, 0x42, 0x44,   0x5f, 0x38, 0x40,   0x7c, 0x47, 0x50,   0xaa, 0x80, 0x78,   0xb5, 0x8f, 0x84,   0xa0, 0x80, 0x76,   0x82, 0x63, 0x57,   0x87, 0x6a, 0x62,   0x5d, 0x59, 0x5b,   0x59, 0x5a, 0x5c,   0x56, 0x56, 0x58,   0x5d, 0x58, 0x5a,   0x50, 0x4e, 0x4d,   0x4e, 0x4d, 0x4b,   0x3f, 0x3e, 0x3c,   0x3f, 0x3e, 0x3c,   0x46, 0x44, 0x42,   0x52, 0x51, 0x51,   0x54, 0x52, 0x54,   0x5c, 0x5b, 0x59,   0x54, 0x54, 0x53,   0x57, 0x58, 0x58,   0x5a, 0x5a, 0x58,   0x56, 0x55, 0x54,   0x58, 0x57, 0x55,   0x5e, 0x5d, 0x59,   0x5c, 0x5b, 0x58,   
-	0x7a, 0x7b, 0x7d,   0x7b, 0x7c, 0x7e,   0x78, 0x79, 0x7b,   0x76, 0x76, 0x78,   0x74, 0x74, 0x76,   0x74, 0x74, 0x76,   0x7d, 0x7c, 0x7e,   0x77, 0x75, 0x76,   0x84, 0x83, 0x82,   0x78, 0x75, 0x73,   0x79, 0x60, 0x5a,   0x7a, 0x54, 0x51,   0x6f, 0x34, 0x40,   0x9e, 0x59, 0x6a,   0xa4, 0x5b, 0x6e,   0xa3, 0x64, 0x6d,   0xb1, 0x89, 0x7e,   0xa3, 0x7e, 0x72,   0x86, 0x68, 0x64,   0x88, 0x6c, 0x61,   0x9f, 0x7b, 0x6d,   0x6d, 0x63, 0x67,   0x5d, 0x5e, 0x61,   0x5a, 0x5a, 0x5b,   0x59, 0x55, 0x56,   0x52, 0x4e, 0x4e,   0x55, 0x52, 0x51,   0x46, 0x45, 0x43,   0x3a, 0x39, 0x37,   0x40, 0x3f, 0x3d,   0x5a, 0x59, 0x5a,   0x53, 0x53, 0x54,   0x4d, 0x4d, 0x4f,   0x56, 0x56, 0x58,   0x58, 0x58, 0x5b,   0x5b, 0x5a, 0x5c,   0x59, 0x57, 0x56,   0x54, 0x54, 0x53,   0x65, 0x62, 0x5f,   0x67, 0x63, 0x60,   
-	0x77, 0x78, 0x7a,   0x78, 0x79, 0x7b,   0x7d, 0x7e, 0x80,   0x78, 0x79, 0x7b,   0x75, 0x74, 0x76,   0x75, 0x75, 0x77,   0x78, 0x77, 0x77,   0x79, 0x78, 0x77,   0x86, 0x86, 0x84,   0x7f, 0x7f, 0x7e,   0x6f, 0x64, 0x63,   0x80, 0x5e, 0x57,   0x81, 0x53, 0x4e,   0x79, 0x46, 0x4a,   0x95, 0x67, 0x6b,   0xbd, 0x99, 0x93,   0xbb, 0x96, 0x89,   0x8f, 0x71, 0x68,   0x78, 0x5f, 0x5b,   0xa1, 0x84, 0x77,   0xad, 0x87, 0x72,   0xa4, 0xa1, 0xab,   0x81, 0x86, 0x93,   0x56, 0x54, 0x54,   0x58, 0x56, 0x59,   0x4e, 0x4b, 0x4d,   0x4b, 0x47, 0x46,   0x3f, 0x3e, 0x3c,   0x41, 0x40, 0x3e,   0x52, 0x51, 0x4f,   0x59, 0x58, 0x59,   0x50, 0x50, 0x52,   0x55, 0x55, 0x57,   0x57, 0x57, 0x59,   0x59, 0x59, 0x5b,   0x60, 0x5e, 0x61,   0x5f, 0x5d, 0x5c,   0x5c, 0x5b, 0x59,   0x66, 0x63, 0x61,   0x5f, 0x5c, 0x5a,   
-	0x7a, 0x7b, 0x7d,   0x82, 0x83, 0x85,   0x7e, 0x7f, 0x81,   0x72, 0x72, 0x74,   0x71, 0x71, 0x73,   0x79, 0x79, 0x7b,   0x77, 0x77, 0x76,   0x7d, 0x7b, 0x79,   0x81, 0x81, 0x7f,   0x7f, 0x7f, 0x7e,   0x7d, 0x7f, 0x7d,   0x72, 0x66, 0x63,   0x86, 0x6a, 0x60,   0x9f, 0x7b, 0x78,   0xa6, 0x86, 0x87,   0xa3, 0x85, 0x85,   0x8a, 0x70, 0x6d,   0x6d, 0x53, 0x4f,   0x83, 0x67, 0x5f,   0xb1, 0x93, 0x81,   0xb3, 0x98, 0x8c,   0xbc, 0xc8, 0xdd,   0xb7, 0xc2, 0xdc,   0x5b, 0x58, 0x5d,   0x4c, 0x4b, 0x4c,   0x58, 0x55, 0x59,   0x4e, 0x49, 0x4b,   0x35, 0x34, 0x32,   0x3f, 0x3e, 0x3c,   0x51, 0x50, 0x4e,   0x53, 0x53, 0x53,   0x4d, 0x4d, 0x4f,   0x56, 0x56, 0x58,   0x5f, 0x5f, 0x61,   0x61, 0x61, 0x63,   0x5c, 0x5b, 0x5e,   0x5b, 0x59, 0x58,   0x62, 0x61, 0x5f,   0x65, 0x64, 0x62,   0x5c, 0x5c, 0x5a,   
-	0x7f, 0x80, 0x82,   0x7f, 0x80, 0x82,   0x7d, 0x7e, 0x80,   0x7c, 0x7c, 0x7e,   0x74, 0x75, 0x77,   0x7d, 0x7d, 0x7f,   0x73, 0x71, 0x71,   0x78, 0x77, 0x75,   0x87, 0x88, 0x86,   0x81, 0x82, 0x80,   0x81, 0x81, 0x7f,   0x87, 0x86, 0x85,   0x66, 0x5f, 0x5e,   0x51, 0x42, 0x41,   0x52, 0x43, 0x44,   0x55, 0x43, 0x46,   0x5a, 0x47, 0x46,   0x70, 0x57, 0x50,   0x9d, 0x7f, 0x72,   0xaf, 0x95, 0x84,   0xb3, 0xb4, 0xc0,   0xb1, 0xc2, 0xdd,   0xc5, 0xd2, 0xeb,   0xb8, 0xbf, 0xd4,   0x7a, 0x79, 0x85,   0x54, 0x51, 0x54,   0x44, 0x41, 0x42,   0x3e, 0x3b, 0x39,   0x4b, 0x49, 0x47,   0x58, 0x57, 0x55,   0x55, 0x55, 0x54,   0x4f, 0x4f, 0x50,   0x58, 0x58, 0x59,   0x5f, 0x5f, 0x61,   0x5e, 0x5e, 0x60,   0x5a, 0x58, 0x5b,   0x5d, 0x5c, 0x5b,   0x5e, 0x5d, 0x5b,   0x65, 0x64, 0x62,   0x5d, 0x5c, 0x5a,   
-	0x82, 0x83, 0x86,   0x81, 0x82, 0x85,   0x81, 0x82, 0x84,   0x7c, 0x7d, 0x7f,   0x76, 0x77, 0x7a,   0x7a, 0x7a, 0x7d,   0x72, 0x71, 0x70,   0x7a, 0x79, 0x77,   0x87, 0x86, 0x83,   0x84, 0x82, 0x80,   0x7c, 0x79, 0x78,   0x81, 0x80, 0x7f,   0x7b, 0x77, 0x76,   0x52, 0x46, 0x45,   0x46, 0x35, 0x33,   0x51, 0x3d, 0x38,   0x6a, 0x53, 0x4a,   0x8d, 0x73, 0x64,   0xa2, 0x88, 0x7c,   0xa9, 0xa8, 0xb1,   0xb4, 0xc6, 0xe1,   0xbd, 0xcb, 0xe5,   0xc3, 0xd0, 0xe8,   0xd1, 0xde, 0xf8,   0xd8, 0xe0, 0xfc,   0xbc, 0xbf, 0xd5,   0x7d, 0x7e, 0x8c,   0x42, 0x3f, 0x41,   0x3f, 0x3b, 0x39,   0x55, 0x54, 0x51,   0x58, 0x58, 0x57,   0x51, 0x51, 0x51,   0x54, 0x54, 0x56,   0x5a, 0x5a, 0x5c,   0x59, 0x59, 0x5b,   0x5a, 0x59, 0x5b,   0x5a, 0x59, 0x58,   0x5f, 0x5e, 0x5c,   0x68, 0x67, 0x64,   0x62, 0x61, 0x5f,   
-	0x84, 0x85, 0x88,   0x84, 0x85, 0x86,   0x82, 0x84, 0x83,   0x7e, 0x7f, 0x7f,   0x77, 0x77, 0x77,   0x7b, 0x7c, 0x7c,   0x71, 0x71, 0x70,   0x7c, 0x7b, 0x79,   0x87, 0x86, 0x82,   0x83, 0x82, 0x7f,   0x78, 0x76, 0x75,   0x80, 0x7e, 0x7a,   0x81, 0x83, 0x85,   0x4e, 0x41, 0x43,   0x59, 0x43, 0x3f,   0x6b, 0x54, 0x4f,   0x7b, 0x63, 0x59,   0x91, 0x7a, 0x6f,   0x9b, 0x99, 0x9f,   0xa2, 0xb1, 0xca,   0xa1, 0xb3, 0xcc,   0xa9, 0xb9, 0xd3,   0xbf, 0xcc, 0xe6,   0xcb, 0xd7, 0xf0,   0xce, 0xd9, 0xf3,   0xdb, 0xe4, 0xfc,   0xdc, 0xe7, 0xfc,   0xc0, 0xc7, 0xdc,   0x98, 0x9a, 0xa7,   0x73, 0x71, 0x77,   0x54, 0x50, 0x55,   0x52, 0x4f, 0x52,   0x59, 0x57, 0x5a,   0x5f, 0x5e, 0x61,   0x5b, 0x5c, 0x5d,   0x5e, 0x5e, 0x61,   0x5c, 0x5c, 0x5d,   0x66, 0x65, 0x61,   0x6c, 0x6b, 0x66,   0x65, 0x64, 0x60,   
-	0x86, 0x87, 0x85,   0x87, 0x87, 0x85,   0x84, 0x85, 0x82,   0x82, 0x80, 0x7e,   0x7e, 0x7d, 0x7b,   0x7a, 0x79, 0x77,   0x72, 0x71, 0x6f,   0x7d, 0x7c, 0x7a,   0x88, 0x88, 0x84,   0x81, 0x81, 0x7d,   0x7d, 0x7e, 0x7c,   0x96, 0x9c, 0xa4,   0x89, 0x94, 0xa5,   0x57, 0x55, 0x60,   0x58, 0x44, 0x43,   0x70, 0x57, 0x54,   0x79, 0x63, 0x5b,   0x8a, 0x88, 0x8c,   0x94, 0xa6, 0xba,   0x9b, 0xac, 0xc3,   0x9c, 0xac, 0xc4,   0xb3, 0xc1, 0xda,   0xc3, 0xcf, 0xe7,   0xc6, 0xd1, 0xe8,   0xc6, 0xd2, 0xeb,   0xcc, 0xd7, 0xef,   0xcf, 0xdc, 0xf1,   0xdb, 0xe4, 0xfc,   0xdf, 0xe9, 0xfc,   0xd0, 0xda, 0xef,   0xac, 0xb1, 0xc3,   0x6c, 0x6d, 0x76,   0x57, 0x55, 0x58,   0x5f, 0x5b, 0x60,   0x5c, 0x5b, 0x5d,   0x65, 0x64, 0x67,   0x61, 0x60, 0x62,   0x69, 0x68, 0x65,   0x6f, 0x6e, 0x6a,   0x6a, 0x69, 0x65,   
-	0x88, 0x88, 0x86,   0x88, 0x88, 0x86,   0x87, 0x87, 0x85,   0x84, 0x83, 0x81,   0x7c, 0x7b, 0x79,   0x7a, 0x79, 0x77,   0x76, 0x76, 0x74,   0x7f, 0x7d, 0x7b,   0x88, 0x87, 0x85,   0x7e, 0x81, 0x81,   0xa1, 0xa7, 0xb4,   0xa4, 0xae, 0xc4,   0x8b, 0x97, 0xaa,   0x7b, 0x83, 0x94,   0x56, 0x51, 0x52,   0x5a, 0x4a, 0x49,   0x73, 0x77, 0x81,   0x7f, 0x92, 0xa2,   0x83, 0x94, 0xa4,   0x8c, 0x9c, 0xac,   0xb1, 0xbf, 0xd1,   0xc0, 0xc9, 0xde,   0xc9, 0xd2, 0xe6,   0xc7, 0xd3, 0xe7,   0xc1, 0xce, 0xe2,   0xc5, 0xd2, 0xe7,   0xc9, 0xd4, 0xea,   0xcd, 0xd9, 0xed,   0xcf, 0xda, 0xed,   0xd2, 0xdd, 0xf2,   0xda, 0xe7, 0xfc,   0xcf, 0xdb, 0xf3,   0x97, 0x9f, 0xb2,   0x77, 0x77, 0x89,   0x60, 0x5d, 0x61,   0x66, 0x64, 0x65,   0x63, 0x61, 0x63,   0x6d, 0x6c, 0x69,   0x70, 0x6f, 0x6b,   0x6a, 0x69, 0x65,   
-	0x8a, 0x8a, 0x88,   0x89, 0x8a, 0x88,   0x87, 0x89, 0x86,   0x86, 0x86, 0x84,   0x79, 0x79, 0x77,   0x79, 0x78, 0x76,   0x79, 0x78, 0x76,   0x81, 0x80, 0x7e,   0x87, 0x87, 0x87,   0x97, 0x9d, 0xa9,   0xab, 0xb4, 0xcb,   0x9b, 0xa6, 0xb8,   0x92, 0x9c, 0xaf,   0x92, 0x9b, 0xad,   0x6d, 0x73, 0x7f,   0x7b, 0x82, 0x8f,   0x88, 0x9c, 0xb0,   0x86, 0x97, 0xa9,   0x99, 0xa8, 0xb7,   0xae, 0xbc, 0xc8,   0xbb, 0xc6, 0xd2,   0xc6, 0xcc, 0xdf,   0xc2, 0xca, 0xde,   0xc2, 0xcd, 0xdf,   0xba, 0xc8, 0xda,   0xc1, 0xcf, 0xe4,   0xc7, 0xd3, 0xe9,   0xc7, 0xd3, 0xe6,   0xc9, 0xd3, 0xe7,   0xcf, 0xda, 0xf0,   0xcf, 0xda, 0xf0,   0xcf, 0xdb, 0xf4,   0xca, 0xd9, 0xf6,   0xb3, 0xc0, 0xe0,   0x77, 0x79, 0x83,   0x64, 0x62, 0x60,   0x6c, 0x6a, 0x68,   0x72, 0x6e, 0x6b,   0x71, 0x6d, 0x6a,   0x6e, 0x6a, 0x67,   
-	0x8a, 0x8a, 0x88,   0x8a, 0x8b, 0x89,   0x86, 0x88, 0x85,   0x85, 0x86, 0x84,   0x7b, 0x7a, 0x78,   0x7b, 0x7a, 0x78,   0x79, 0x78, 0x77,   0x84, 0x82, 0x7f,   0x8a, 0x8b, 0x8c,   0x9b, 0xa5, 0xb4,   0x9a, 0xa6, 0xb8,   0x97, 0xa3, 0xb5,   0x9e, 0xa8, 0xbb,   0x88, 0x90, 0xa3,   0x4c, 0x54, 0x62,   0x9a, 0xa7, 0xb7,   0xad, 0xbb, 0xd1,   0xa8, 0xb8, 0xca,   0xb8, 0xc6, 0xd2,   0xb6, 0xc0, 0xcc,   0xbb, 0xc2, 0xd0,   0xb9, 0xc1, 0xd3,   0xbc, 0xc3, 0xd6,   0xc0, 0xc7, 0xda,   0xb6, 0xc1, 0xd4,   0xba, 0xc5, 0xdb,   0xbf, 0xcb, 0xe1,   0xc4, 0xcf, 0xe5,   0xc7, 0xd2, 0xe7,   0xc8, 0xd3, 0xe9,   0xc5, 0xd1, 0xe7,   0xc8, 0xd4, 0xec,   0xc8, 0xd5, 0xf0,   0xcf, 0xdd, 0xfa,   0xb0, 0xb8, 0xcc,   0x69, 0x68, 0x6a,   0x6a, 0x68, 0x65,   0x72, 0x6e, 0x6b,   0x72, 0x6e, 0x6b,   0x6e, 0x6b, 0x68,   
-	0x89, 0x8c, 0x88,   0x89, 0x8b, 0x88,   0x8b, 0x8b, 0x89,   0x85, 0x85, 0x83,   0x7b, 0x7a, 0x78,   0x7a, 0x79, 0x76,   0x7f, 0x7e, 0x7d,   0x88, 0x87, 0x82,   0x89, 0x89, 0x87,   0x8f, 0x98, 0xa6,   0x9c, 0xa6, 0xb8,   0x9d, 0xa8, 0xbb,   0x96, 0x9f, 0xb4,   0x4a, 0x51, 0x61,   0x6a, 0x71, 0x86,   0x88, 0x91, 0xa7,   0xaf, 0xb9, 0xcf,   0xaf, 0xba, 0xcb,   0xab, 0xb4, 0xc2,   0xaa, 0xb0, 0xc1,   0xb5, 0xbd, 0xce,   0xb7, 0xc0, 0xd1,   0xb4, 0xbf, 0xd1,   0xba, 0xc5, 0xd9,   0xb5, 0xc0, 0xd7,   0xb6, 0xc1, 0xd8,   0xb6, 0xc1, 0xd7,   0xba, 0xc5, 0xdb,   0xbb, 0xc6, 0xdc,   0xb9, 0xc4, 0xda,   0xba, 0xc5, 0xdc,   0xbb, 0xc7, 0xdf,   0xc3, 0xd0, 0xeb,   0xc5, 0xd4, 0xee,   0xd0, 0xdd, 0xf8,   0xae, 0xb2, 0xc4,   0x6a, 0x67, 0x68,   0x6d, 0x69, 0x65,   0x73, 0x6f, 0x6d,   0x72, 0x70, 0x6d,   
-	0x8b, 0x8c, 0x8a,   0x8e, 0x8e, 0x8c,   0x91, 0x91, 0x8f,   0x88, 0x8a, 0x88,   0x7e, 0x7f, 0x7c,   0x7e, 0x7d, 0x7b,   0x82, 0x81, 0x7f,   0x89, 0x88, 0x86,   0x8d, 0x8d, 0x8b,   0x8d, 0x95, 0xa5,   0x9c, 0xa8, 0xbb,   0xa2, 0xb0, 0xc2,   0x85, 0x93, 0xa7,   0x70, 0x79, 0x89,   0xa0, 0xa8, 0xba,   0x96, 0xa0, 0xb8,   0x92, 0x9c, 0xb0,   0xc4, 0xcd, 0xd6,   0xa0, 0xa8, 0xb8,   0xab, 0xb3, 0xc7,   0xb7, 0xbf, 0xd3,   0xb8, 0xc1, 0xd5,   0xb4, 0xc0, 0xd4,   0xba, 0xc6, 0xdc,   0xb5, 0xc0, 0xd7,   0xb4, 0xbe, 0xd5,   0xae, 0xb9, 0xce,   0xa8, 0xb2, 0xc8,   0xa8, 0xb3, 0xc9,   0xa7, 0xb2, 0xc8,   0xab, 0xba, 0xcf,   0xb4, 0xc2, 0xd8,   0xa9, 0xb7, 0xd1,   0x9b, 0xa8, 0xc3,   0x9f, 0xad, 0xc6,   0xc0, 0xcc, 0xe8,   0xa4, 0xa8, 0xb8,   0x73, 0x6f, 0x6c,   0x7c, 0x77, 0x72,   0x76, 0x76, 0x71,   
-	0x8d, 0x8d, 0x8b,   0x8e, 0x8e, 0x8c,   0x95, 0x95, 0x93,   0x8c, 0x8e, 0x8b,   0x81, 0x83, 0x80,   0x81, 0x80, 0x7e,   0x82, 0x81, 0x7f,   0x89, 0x88, 0x86,   0x87, 0x86, 0x85,   0x8a, 0x91, 0xa2,   0xa0, 0xab, 0xc0,   0x9f, 0xad, 0xc0,   0x94, 0xa3, 0xb6,   0x91, 0x9a, 0xaf,   0x9e, 0xa7, 0xbc,   0x9f, 0xaa, 0xc0,   0x97, 0xa1, 0xb5,   0x9e, 0xa6, 0xb1,   0xa2, 0xaa, 0xbd,   0xb2, 0xbb, 0xd1,   0xb5, 0xbe, 0xd3,   0xb7, 0xc2, 0xd6,   0xb4, 0xbf, 0xd4,   0xba, 0xc5, 0xdb,   0xb3, 0xbe, 0xd4,   0xac, 0xb7, 0xcd,   0xae, 0xb9, 0xce,   0xa4, 0xac, 0xc3,   0x9a, 0xa5, 0xbb,   0x99, 0xa5, 0xbb,   0xa4, 0xb1, 0xc7,   0x9f, 0xad, 0xc2,   0xab, 0xb9, 0xd3,   0xae, 0xbb, 0xd5,   0x9c, 0xa6, 0xc0,   0x91, 0x9e, 0xb8,   0xa9, 0xb6, 0xd3,   0xa7, 0xad, 0xbe,   0x89, 0x89, 0x87,   0x76, 0x75, 0x6e,   
-	0x8e, 0x8e, 0x8c,   0x91, 0x91, 0x8f,   0x94, 0x94, 0x92,   0x91, 0x92, 0x8e,   0x86, 0x88, 0x83,   0x83, 0x81, 0x80,   0x88, 0x87, 0x85,   0x8a, 0x89, 0x87,   0x87, 0x85, 0x84,   0x84, 0x8a, 0x99,   0x9f, 0xab, 0xc1,   0x9b, 0xa8, 0xbd,   0x96, 0xa5, 0xb8,   0x99, 0xa7, 0xbc,   0xa3, 0xaa, 0xbb,   0xa5, 0xad, 0xba,   0xa2, 0xaa, 0xbf,   0x8f, 0x97, 0xab,   0xad, 0xb6, 0xcb,   0xb1, 0xbd, 0xd2,   0xb3, 0xbf, 0xd2,   0xb4, 0xc1, 0xd4,   0xb4, 0xc0, 0xd5,   0xba, 0xc5, 0xdb,   0xb5, 0xc1, 0xd9,   0xa7, 0xb2, 0xca,   0xa7, 0xb2, 0xca,   0xa7, 0xb0, 0xc7,   0x8e, 0x9b, 0xb4,   0x8f, 0x9c, 0xb5,   0xa0, 0xab, 0xc4,   0x93, 0x9f, 0xb7,   0xa9, 0xb7, 0xd2,   0xb8, 0xc4, 0xdf,   0xb9, 0xc4, 0xe0,   0xab, 0xb6, 0xd4,   0x98, 0xa7, 0xc3,   0xa9, 0xba, 0xd8,   0xaf, 0xbb, 0xd1,   0x7d, 0x7c, 0x7e,   
-	0x87, 0x89, 0x86,   0x8d, 0x8f, 0x8b,   0x91, 0x92, 0x8f,   0x8c, 0x8e, 0x89,   0x85, 0x87, 0x82,   0x83, 0x84, 0x80,   0x84, 0x83, 0x80,   0x8c, 0x8b, 0x88,   0x8e, 0x8c, 0x8b,   0x82, 0x89, 0x94,   0x9d, 0xab, 0xc2,   0x9a, 0xa7, 0xbd,   0x96, 0xa3, 0xb8,   0x96, 0xa1, 0xb8,   0xae, 0xb5, 0xc1,   0xae, 0xb5, 0xbb,   0xa1, 0xa8, 0xbf,   0xae, 0xb6, 0xcc,   0xb2, 0xba, 0xd1,   0xaf, 0xba, 0xcf,   0xb5, 0xc0, 0xd5,   0xb4, 0xc0, 0xd4,   0xb3, 0xbe, 0xd4,   0xb6, 0xc1, 0xd7,   0xb0, 0xbc, 0xd4,   0xa9, 0xb5, 0xcd,   0xa3, 0xae, 0xc5,   0x9f, 0xad, 0xc4,   0x8a, 0x9a, 0xb3,   0x8a, 0x9a, 0xb4,   0x96, 0xa4, 0xbc,   0x8d, 0x99, 0xb0,   0x8e, 0x9c, 0xb6,   0xb5, 0xc3, 0xde,   0xb4, 0xc1, 0xdc,   0xb9, 0xc6, 0xe2,   0xad, 0xbb, 0xd6,   0x9c, 0xa8, 0xc3,   0x9e, 0xaa, 0xca,   0xa7, 0xb0, 0xca,   
-	0x89, 0x8c, 0x86,   0x8c, 0x8e, 0x89,   0x8e, 0x90, 0x8b,   0x8a, 0x8c, 0x87,   0x81, 0x82, 0x7d,   0x84, 0x85, 0x80,   0x87, 0x86, 0x82,   0x91, 0x8f, 0x8c,   0x8e, 0x8d, 0x88,   0x8d, 0x93, 0x9b,   0x9e, 0xac, 0xc4,   0x9e, 0xa9, 0xc0,   0x97, 0xa4, 0xba,   0x96, 0xa1, 0xb6,   0xaa, 0xb3, 0xc9,   0xaa, 0xb1, 0xc6,   0xa6, 0xad, 0xc1,   0xae, 0xb6, 0xcb,   0xb0, 0xb8, 0xcf,   0xae, 0xb8, 0xce,   0xb6, 0xc2, 0xd8,   0xb2, 0xbd, 0xd4,   0xb4, 0xbf, 0xd5,   0xb6, 0xc1, 0xd7,   0xac, 0xb8, 0xd0,   0xa8, 0xb4, 0xcc,   0xa0, 0xab, 0xc3,   0x9d, 0xab, 0xc4,   0x86, 0x96, 0xb2,   0x82, 0x91, 0xad,   0x92, 0xa0, 0xbb,   0x9b, 0xa9, 0xc3,   0x7d, 0x8b, 0xa6,   0x88, 0x96, 0xb0,   0xb4, 0xc2, 0xdd,   0xb8, 0xc6, 0xe1,   0xb6, 0xc4, 0xdf,   0xb0, 0xbd, 0xd9,   0xa6, 0xb4, 0xd1,   0x9e, 0xad, 0xca,   
-	0x8b, 0x8d, 0x88,   0x8c, 0x8e, 0x88,   0x8c, 0x8e, 0x89,   0x86, 0x88, 0x83,   0x83, 0x83, 0x7e,   0x8b, 0x8a, 0x86,   0x8c, 0x8b, 0x87,   0x8e, 0x8d, 0x8a,   0x8b, 0x8a, 0x85,   0x89, 0x8f, 0x95,   0x99, 0xa7, 0xc0,   0x9f, 0xa9, 0xc2,   0x98, 0xa4, 0xba,   0x9a, 0xa6, 0xbc,   0x9d, 0xa8, 0xbe,   0xa9, 0xb3, 0xc9,   0xa8, 0xb0, 0xc6,   0xac, 0xb4, 0xcb,   0xb2, 0xba, 0xd0,   0xad, 0xb6, 0xcf,   0xb4, 0xbf, 0xd7,   0xb1, 0xbd, 0xd5,   0xb1, 0xbd, 0xd4,   0xae, 0xba, 0xd2,   0xad, 0xb9, 0xd1,   0xa8, 0xb6, 0xcd,   0x9c, 0xa8, 0xc3,   0x9a, 0xa8, 0xc3,   0x88, 0x98, 0xb1,   0x6e, 0x7b, 0x9a,   0x94, 0xa3, 0xbe,   0x9a, 0xa9, 0xc3,   0x87, 0x97, 0xb1,   0x74, 0x83, 0x9e,   0x83, 0x93, 0xac,   0xb4, 0xc4, 0xde,   0xb8, 0xc7, 0xe1,   0xb1, 0xc2, 0xdb,   0xa7, 0xb6, 0xd2,   0xa3, 0xb1, 0xce,   
-	0x8b, 0x8d, 0x88,   0x8b, 0x8d, 0x88,   0x8b, 0x8d, 0x88,   0x87, 0x89, 0x84,   0x8a, 0x89, 0x85,   0x8a, 0x89, 0x85,   0x89, 0x88, 0x84,   0x8e, 0x8d, 0x89,   0x8f, 0x8e, 0x89,   0x91, 0x97, 0x9c,   0x9d, 0xab, 0xc4,   0xa0, 0xab, 0xc3,   0x92, 0x9e, 0xb5,   0x9b, 0xa6, 0xbb,   0x9a, 0xa6, 0xbb,   0xa6, 0xb0, 0xc6,   0xb1, 0xb8, 0xd3,   0xaf, 0xb6, 0xd0,   0xb0, 0xb8, 0xd0,   0xae, 0xb8, 0xd1,   0xb3, 0xbd, 0xd6,   0xb2, 0xbf, 0xd7,   0xb1, 0xbd, 0xd5,   0xaa, 0xb6, 0xce,   0xa7, 0xb2, 0xca,   0xa7, 0xb3, 0xcb,   0x9e, 0xab, 0xc4,   0x93, 0xa1, 0xbb,   0x8a, 0x98, 0xb3,   0x66, 0x71, 0x8c,   0x79, 0x87, 0xa1,   0x9b, 0xa9, 0xc6,   0x8d, 0x9c, 0xba,   0x82, 0x91, 0xae,   0x69, 0x77, 0x93,   0x8f, 0x9d, 0xb8,   0xb7, 0xc7, 0xe2,   0xba, 0xca, 0xe4,   0xb8, 0xc7, 0xe4,   0xac, 0xbb, 0xd8,   
-	0x8d, 0x8f, 0x8a,   0x8d, 0x8f, 0x8a,   0x8c, 0x8e, 0x89,   0x89, 0x8b, 0x86,   0x88, 0x88, 0x84,   0x87, 0x86, 0x82,   0x87, 0x86, 0x82,   0x8d, 0x8c, 0x88,   0x8b, 0x8a, 0x85,   0x88, 0x8e, 0x93,   0x99, 0xa7, 0xbc,   0xa2, 0xac, 0xc4,   0x8d, 0x99, 0xaf,   0x99, 0xa4, 0xb8,   0x9b, 0xa6, 0xbb,   0x9e, 0xa8, 0xbe,   0xae, 0xb5, 0xcf,   0xaf, 0xb7, 0xcf,   0xaf, 0xb6, 0xd0,   0xad, 0xb6, 0xd2,   0xb2, 0xbc, 0xd7,   0xb2, 0xbe, 0xd8,   0xac, 0xb8, 0xd1,   0xab, 0xb7, 0xce,   0xa8, 0xb3, 0xcc,   0xa5, 0xb1, 0xc9,   0x9a, 0xa8, 0xbf,   0x9a, 0xa7, 0xc2,   0x8a, 0x97, 0xb5,   0x69, 0x76, 0x8d,   0x5d, 0x66, 0x7b,   0x98, 0xa4, 0xbf,   0x9a, 0xa8, 0xc8,   0x88, 0x96, 0xb4,   0x74, 0x81, 0x9d,   0x68, 0x75, 0x90,   0x8f, 0xa0, 0xb8,   0xb7, 0xc7, 0xe3,   0xb6, 0xc4, 0xe3,   0xb6, 0xc5, 0xe2,   
-	0x8d, 0x8f, 0x8a,   0x8f, 0x91, 0x8c,   0x8e, 0x90, 0x8b,   0x8b, 0x8d, 0x88,   0x84, 0x85, 0x80,   0x86, 0x85, 0x81,   0x87, 0x86, 0x82,   0x89, 0x89, 0x85,   0x88, 0x89, 0x83,   0x88, 0x8a, 0x8d,   0x97, 0xa1, 0xb7,   0x9f, 0xaa, 0xc2,   0x93, 0x9f, 0xb5,   0x9a, 0xa5, 0xb8,   0x95, 0xa0, 0xb7,   0x95, 0x9f, 0xb5,   0xa4, 0xad, 0xc3,   0xad, 0xb7, 0xcd,   0xae, 0xb6, 0xd1,   0xaf, 0xb8, 0xd4,   0xaf, 0xb9, 0xd5,   0xac, 0xb9, 0xd2,   0xac, 0xb8, 0xd1,   0xa3, 0xaf, 0xc8,   0xa4, 0xb2, 0xcb,   0x96, 0xa5, 0xbe,   0x90, 0x9f, 0xb8,   0x94, 0xa4, 0xbe,   0x84, 0x93, 0xae,   0x71, 0x7c, 0x92,   0x4d, 0x54, 0x64,   0x65, 0x6e, 0x83,   0x92, 0xa0, 0xbc,   0x8f, 0x9e, 0xbc,   0x7c, 0x8c, 0xa6,   0x5f, 0x6f, 0x88,   0x65, 0x75, 0x8e,   0x92, 0xa2, 0xbb,   0xb3, 0xc3, 0xdf,   0xb4, 0xc3, 0xe0,   
-	0x90, 0x92, 0x8d,   0x90, 0x92, 0x8d,   0x90, 0x92, 0x8d,   0x8b, 0x8d, 0x88,   0x85, 0x86, 0x82,   0x86, 0x85, 0x81,   0x8a, 0x89, 0x85,   0x8b, 0x8a, 0x86,   0x88, 0x88, 0x82,   0x89, 0x8a, 0x8d,   0x96, 0xa0, 0xb7,   0x9c, 0xa8, 0xbf,   0x99, 0xa5, 0xbc,   0xa0, 0xaa, 0xc0,   0xa2, 0xab, 0xb7,   0x94, 0x9f, 0xb7,   0x99, 0xa5, 0xbb,   0xab, 0xb6, 0xcd,   0xa9, 0xb3, 0xce,   0xaa, 0xb7, 0xd3,   0xa7, 0xb4, 0xcf,   0x9f, 0xae, 0xc7,   0xa5, 0xb3, 0xcd,   0x9e, 0xac, 0xc7,   0x99, 0xa8, 0xc4,   0x89, 0x99, 0xb4,   0x99, 0xa8, 0xc4,   0x85, 0x94, 0xb1,   0x80, 0x8e, 0xa8,   0x78, 0x82, 0x99,   0x48, 0x4f, 0x61,   0x48, 0x4f, 0x60,   0x65, 0x6f, 0x86,   0x91, 0x9f, 0xbb,   0x7e, 0x8e, 0xa9,   0x78, 0x87, 0xa3,   0x86, 0x96, 0xb0,   0x94, 0xa4, 0xbd,   0xa4, 0xb2, 0xce,   0xb3, 0xc2, 0xdf,   
-	0x97, 0x97, 0x92,   0x95, 0x94, 0x90,   0x93, 0x94, 0x8f,   0x8c, 0x8e, 0x89,   0x85, 0x86, 0x81,   0x85, 0x86, 0x81,   0x8a, 0x8a, 0x85,   0x8a, 0x8a, 0x86,   0x8a, 0x8a, 0x84,   0x88, 0x88, 0x89,   0x8d, 0x96, 0xac,   0x98, 0xa4, 0xbb,   0x93, 0x9e, 0xb7,   0x92, 0x9e, 0xb2,   0xa4, 0xad, 0xae,   0x9b, 0xa8, 0xbe,   0x9b, 0xa6, 0xbf,   0xa6, 0xb1, 0xc8,   0x98, 0xa3, 0xbc,   0xaa, 0xb7, 0xd4,   0xa0, 0xad, 0xca,   0x9f, 0xae, 0xcb,   0xa2, 0xb0, 0xcd,   0xa3, 0xb1, 0xce,   0x9d, 0xab, 0xca,   0x96, 0xa5, 0xc3,   0x8d, 0x9c, 0xbb,   0x8a, 0x9a, 0xb6,   0x7d, 0x8a, 0xa3,   0x7e, 0x89, 0x9f,   0x6b, 0x75, 0x8d,   0x45, 0x4c, 0x5f,   0x54, 0x5b, 0x69,   0x68, 0x75, 0x90,   0x8a, 0x9a, 0xb9,   0x7f, 0x8e, 0xac,   0x86, 0x95, 0xb3,   0x97, 0xa6, 0xc2,   0x9d, 0xac, 0xc8,   0xa4, 0xb2, 0xcf,   
-	0x9b, 0x97, 0x94,   0x98, 0x96, 0x93,   0x92, 0x94, 0x8f,   0x8c, 0x8e, 0x89,   0x89, 0x8b, 0x86,   0x85, 0x87, 0x82,   0x87, 0x89, 0x84,   0x88, 0x8b, 0x85,   0x88, 0x8b, 0x86,   0x86, 0x88, 0x83,   0x89, 0x90, 0xa2,   0x8c, 0x98, 0xb1,   0x87, 0x92, 0xa9,   0x8e, 0x9b, 0xb2,   0x93, 0x9f, 0xb6,   0x8b, 0x96, 0xac,   0x8f, 0x9a, 0xb0,   0x9f, 0xaa, 0xc2,   0x9c, 0xa8, 0xc3,   0xa6, 0xb4, 0xd1,   0xa4, 0xb2, 0xd1,   0x9b, 0xa9, 0xc9,   0x9e, 0xac, 0xcb,   0x98, 0xa7, 0xc4,   0x93, 0xa2, 0xc0,   0x9d, 0xab, 0xcb,   0x95, 0xa4, 0xc4,   0x82, 0x92, 0xac,   0x73, 0x80, 0x98,   0x6c, 0x78, 0x8f,   0x7d, 0x8a, 0xa4,   0x61, 0x6a, 0x82,   0x42, 0x48, 0x56,   0x51, 0x59, 0x6e,   0x84, 0x94, 0xb2,   0x81, 0x8f, 0xad,   0x8c, 0x9b, 0xb7,   0x99, 0xa8, 0xc4,   0x9f, 0xad, 0xcb,   0xa3, 0xb1, 0xcf,   
-	0x97, 0x97, 0x92,   0x95, 0x97, 0x92,   0x92, 0x94, 0x8f,   0x8f, 0x91, 0x8c,   0x8a, 0x8c, 0x87,   0x85, 0x87, 0x82,   0x87, 0x89, 0x84,   0x87, 0x89, 0x84,   0x88, 0x8a, 0x85,   0x8a, 0x8b, 0x85,   0x88, 0x8f, 0x9e,   0x8c, 0x99, 0xb1,   0x87, 0x93, 0xaa,   0x93, 0x9f, 0xb6,   0xa1, 0xac, 0xc4,   0x93, 0x9f, 0xb4,   0x8c, 0x9a, 0xae,   0x96, 0xa3, 0xba,   0x94, 0xa2, 0xbd,   0x9b, 0xa9, 0xc8,   0xa6, 0xb4, 0xd3,   0x9a, 0xa8, 0xc7,   0x9c, 0xaa, 0xc9,   0x96, 0xa5, 0xc4,   0x93, 0xa2, 0xc0,   0x95, 0xa3, 0xc3,   0x9d, 0xab, 0xcb,   0x83, 0x94, 0xad,   0x85, 0x94, 0xab,   0x83, 0x92, 0xab,   0x81, 0x90, 0xaa,   0x84, 0x92, 0xad,   0x55, 0x60, 0x74,   0x38, 0x3d, 0x4a,   0x69, 0x71, 0x88,   0x85, 0x91, 0xaf,   0x74, 0x81, 0x9c,   0x96, 0xa5, 0xc1,   0xa3, 0xb1, 0xcf,   0xb0, 0xbf, 0xde,   
+const struct IMG_Image ffrank_asset = {
+		.name = "ffrank",
+		.data = (const uint8_t*)ffrank_data,
+		.size = sizeof(ffrank_data),
+		.width = 40,
+		.height = 40,
+		.encoding = IMG_ENCODING_RAW,
+		.format = PIXEL_FORMAT_666,
 };
-#endif
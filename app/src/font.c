@@ -0,0 +1,133 @@
+/*
+ * font.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include "font.h"
+#include "image.h"
+
+// Whole string in the controller pixel format, must not change until DMA is done reading it
+static uint8_t font_buffer[FONT_BUFFER_SIZE] __attribute__((aligned(4)));
+static ST7735_Handle font_handle = 0;
+
+static const uint8_t* FONT_GetGlyph(const struct FONT_Font* font, const char c, uint8_t* width, uint8_t* advance) {
+	// Glyph bitmap and metrics, characters out of the font range are drawn as '?' (or blank)
+	uint8_t code = (uint8_t)c;
+
+	if (code < font->first || code > font->last) code = '?';
+	if (code < font->first || code > font->last) code = font->first;
+
+	const uint32_t index = code - font->first;
+
+	if (font->glyphs == 0) {
+		*width = font->width;
+		*advance = font->advance;
+		return font->bitmap + index * font->rows * ((font->width + 7) / 8);
+	}
+
+	const struct FONT_Glyph* glyph = &font->glyphs[index];
+
+	*width = glyph->width;
+	*advance = glyph->advance;
+	return font->bitmap + glyph->offset;
+}
+
+uint32_t FONT_GetStringWidth(const struct FONT_Font* font, const char* text) {
+	// Pixels covered by the string, spacing after the last glyph included
+	uint32_t width = 0;
+	uint8_t glyph_width;
+	uint8_t advance;
+
+	while (*text != '\0') {
+		FONT_GetGlyph(font, *(text++), &glyph_width, &advance);
+		width += advance;
+	}
+
+	return width;
+}
+
+static uint32_t FONT_GlyphPixel(const uint8_t* bitmap, const uint8_t width, const uint32_t row, const uint32_t column) {
+	const uint8_t* bits = bitmap + row * ((width + 7) / 8) + column / 8;
+	return (*bits >> (7 - (column % 8))) & 0x01;
+}
+
+static void FONT_DrawTransparent(const struct FONT_Font* font, const char* text, const uint8_t x_start, const uint8_t y_start,
+		const uint32_t color) {
+	// Runs of set pixels of each glyph row, one polled window each
+	uint32_t x = x_start;
+
+	for (; *text != '\0' && x < ST7735_GetWidth(); ++text) {
+		uint8_t width;
+		uint8_t advance;
+		const uint8_t* bitmap = FONT_GetGlyph(font, *text, &width, &advance);
+
+		for (uint32_t row = 0; row < font->rows; ++row) {
+			uint32_t column = 0;
+
+			while (column < width) {
+				if (!FONT_GlyphPixel(bitmap, width, row, column)) {
+					++column;
+					continue;
+				}
+
+				const uint32_t run_start = column;
+				while (column < width && FONT_GlyphPixel(bitmap, width, row, column)) ++column;
+
+				const uint32_t run_x = x + run_start;
+				if (run_x < ST7735_GetWidth()) ST7735_DrawRectangle(run_x, y_start + row, x + column - 1, y_start + row, color);
+			}
+		}
+
+		x += advance;
+	}
+}
+
+ST7735_Handle FONT_DrawString(const struct FONT_Font* font, const char* text, const uint8_t x_start, const uint8_t y_start,
+		const uint32_t color, const uint32_t background, const enum FONT_MODE mode) {
+	// FONT_MODE_FILL : the string is rasterized into the line buffer and sent with a single windowed DMA write,
+	// redrawing a readout over itself needs no clear
+	// Colors are driver color values (RED_666, RED_565, ...), the string is clipped to the logical display bounds
+	if (x_start >= ST7735_GetWidth() || y_start >= ST7735_GetHeight() || font->height > FONT_HEIGHT_MAX) return 0;
+
+	if (mode == FONT_MODE_TRANSPARENT) {
+		FONT_DrawTransparent(font, text, x_start, y_start, color);
+		return 0;
+	}
+
+	// Clipped here rather than by the driver : the window always matches the buffer, which is sent in one piece
+	// (the driver's strided clipping needs even widths in 4-4-4)
+	uint32_t width = FONT_GetStringWidth(font, text);
+	if (width > (uint32_t)(ST7735_GetWidth() - x_start)) width = ST7735_GetWidth() - x_start;
+	if (width == 0) return 0;
+
+	uint32_t height = font->height;
+	if (height > (uint32_t)(ST7735_GetHeight() - y_start)) height = ST7735_GetHeight() - y_start;
+
+	const enum PIXEL_FORMAT format = ST7735_GetPixelFormat();
+
+	// The previous string may still be on the bus
+	ST7735_Wait(font_handle);
+
+	// Row by row over the whole string, every pixel written once
+	uint32_t i = 0;
+
+	for (uint32_t row = 0; row < height; ++row) {
+		const char* c = text;
+		uint32_t x = 0;
+
+		while (x < width) {
+			uint8_t glyph_width;
+			uint8_t advance;
+			const uint8_t* bitmap = FONT_GetGlyph(font, *(c++), &glyph_width, &advance);
+
+			for (uint32_t column = 0; column < advance && x < width; ++column, ++x) {
+				const uint32_t set = row < font->rows && column < glyph_width && FONT_GlyphPixel(bitmap, glyph_width, row, column);
+				IMG_StorePixel(font_buffer, i++, set ? color : background, format);
+			}
+		}
+	}
+
+	font_handle = ST7735_MemoryWriteDMA(font_buffer, width, height, x_start, y_start);
+	return font_handle;
+}
@@ -0,0 +1,213 @@
+/*
+ * font_5x7p.c
+ *
+ *  Generated by font_gen.py, do not edit
+ */
+
+#include "font.h"
+
+static const uint8_t font_5x7p_bitmap[] = {
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, // '!'
+	0xa0, 0xa0, 0xa0, 0x00, 0x00, 0x00, 0x00, // '"'
+	0x50, 0x50, 0xf8, 0x50, 0xf8, 0x50, 0x50, // '#'
+	0x20, 0x78, 0xa0, 0x70, 0x28, 0xf0, 0x20, // '$'
+	0xc0, 0xc8, 0x10, 0x20, 0x40, 0x98, 0x18, // '%'
+	0x60, 0x90, 0xa0, 0x40, 0xa8, 0x90, 0x68, // '&'
+	0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, // "'"
+	0x20, 0x40, 0x80, 0x80, 0x80, 0x40, 0x20, // '('
+	0x80, 0x40, 0x20, 0x20, 0x20, 0x40, 0x80, // ')'
+	0x00, 0x20, 0xa8, 0x70, 0xa8, 0x20, 0x00, // '*'
+	0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, // '+'
+	0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x80, // ','
+	0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, // '-'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, // '.'
+	0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, // '/'
+	0x70, 0x88, 0x98, 0xa8, 0xc8, 0x88, 0x70, // '0'
+	0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, // '1'
+	0x70, 0x88, 0x08, 0x10, 0x20, 0x40, 0xf8, // '2'
+	0xf8, 0x10, 0x20, 0x10, 0x08, 0x88, 0x70, // '3'
+	0x10, 0x30, 0x50, 0x90, 0xf8, 0x10, 0x10, // '4'
+	0xf8, 0x80, 0xf0, 0x08, 0x08, 0x88, 0x70, // '5'
+	0x30, 0x40, 0x80, 0xf0, 0x88, 0x88, 0x70, // '6'
+	0xf8, 0x08, 0x10, 0x20, 0x40, 0x40, 0x40, // '7'
+	0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70, // '8'
+	0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0x60, // '9'
+	0x00, 0xc0, 0xc0, 0x00, 0xc0, 0xc0, 0x00, // ':'
+	0x00, 0xc0, 0xc0, 0x00, 0xc0, 0x40, 0x80, // ';'
+	0x10, 0x20, 0x40, 0x80, 0x40, 0x20, 0x10, // '<'
+	0x00, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00, // '='
+	0x80, 0x40, 0x20, 0x10, 0x20, 0x40, 0x80, // '>'
+	0x70, 0x88, 0x08, 0x10, 0x20, 0x00, 0x20, // '?'
+	0x70, 0x88, 0x08, 0x68, 0xa8, 0xa8, 0x70, // '@'
+	0x70, 0x88, 0x88, 0x88, 0xf8, 0x88, 0x88, // 'A'
+	0xf0, 0x88, 0x88, 0xf0, 0x88, 0x88, 0xf0, // 'B'
+	0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, // 'C'
+	0xe0, 0x90, 0x88, 0x88, 0x88, 0x90, 0xe0, // 'D'
+	0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0xf8, // 'E'
+	0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x80, // 'F'
+	0x70, 0x88, 0x80, 0xb8, 0x88, 0x88, 0x78, // 'G'
+	0x88, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x88, // 'H'
+	0xe0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xe0, // 'I'
+	0x38, 0x10, 0x10, 0x10, 0x10, 0x90, 0x60, // 'J'
+	0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x88, // 'K'
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xf8, // 'L'
+	0x88, 0xd8, 0xa8, 0xa8, 0x88, 0x88, 0x88, // 'M'
+	0x88, 0x88, 0xc8, 0xa8, 0x98, 0x88, 0x88, // 'N'
+	0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, // 'O'
+	0xf0, 0x88, 0x88, 0xf0, 0x80, 0x80, 0x80, // 'P'
+	0x70, 0x88, 0x88, 0x88, 0xa8, 0x90, 0x68, // 'Q'
+	0xf0, 0x88, 0x88, 0xf0, 0xa0, 0x90, 0x88, // 'R'
+	0x78, 0x80, 0x80, 0x70, 0x08, 0x08, 0xf0, // 'S'
+	0xf8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 'T'
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, // 'U'
+	0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20, // 'V'
+	0x88, 0x88, 0x88, 0xa8, 0xa8, 0xa8, 0x50, // 'W'
+	0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, // 'X'
+	0x88, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, // 'Y'
+	0xf8, 0x08, 0x10, 0x20, 0x40, 0x80, 0xf8, // 'Z'
+	0xe0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xe0, // '['
+	0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, // '\\'
+	0xe0, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, // ']'
+	0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, // '^'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, // '_'
+	0x80, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, // '`'
+	0x00, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78, // 'a'
+	0x80, 0x80, 0xb0, 0xc8, 0x88, 0x88, 0xf0, // 'b'
+	0x00, 0x00, 0x70, 0x80, 0x80, 0x88, 0x70, // 'c'
+	0x08, 0x08, 0x68, 0x98, 0x88, 0x88, 0x78, // 'd'
+	0x00, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x70, // 'e'
+	0x30, 0x48, 0x40, 0xe0, 0x40, 0x40, 0x40, // 'f'
+	0x00, 0x78, 0x88, 0x88, 0x78, 0x08, 0x70, // 'g'
+	0x80, 0x80, 0xb0, 0xc8, 0x88, 0x88, 0x88, // 'h'
+	0x40, 0x00, 0xc0, 0x40, 0x40, 0x40, 0xe0, // 'i'
+	0x10, 0x00, 0x30, 0x10, 0x10, 0x90, 0x60, // 'j'
+	0x80, 0x80, 0x90, 0xa0, 0xc0, 0xa0, 0x90, // 'k'
+	0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xe0, // 'l'
+	0x00, 0x00, 0xd0, 0xa8, 0xa8, 0x88, 0x88, // 'm'
+	0x00, 0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88, // 'n'
+	0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, // 'o'
+	0x00, 0x00, 0xf0, 0x88, 0xf0, 0x80, 0x80, // 'p'
+	0x00, 0x00, 0x68, 0x98, 0x78, 0x08, 0x08, // 'q'
+	0x00, 0x00, 0xb0, 0xc8, 0x80, 0x80, 0x80, // 'r'
+	0x00, 0x00, 0x70, 0x80, 0x70, 0x08, 0xf0, // 's'
+	0x40, 0x40, 0xe0, 0x40, 0x40, 0x48, 0x30, // 't'
+	0x00, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, // 'u'
+	0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x20, // 'v'
+	0x00, 0x00, 0x88, 0x88, 0xa8, 0xa8, 0x50, // 'w'
+	0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, // 'x'
+	0x00, 0x00, 0x88, 0x88, 0x78, 0x08, 0x70, // 'y'
+	0x00, 0x00, 0xf8, 0x10, 0x20, 0x40, 0xf8, // 'z'
+	0x20, 0x40, 0x40, 0x80, 0x40, 0x40, 0x20, // '{'
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, // '|'
+	0x80, 0x40, 0x40, 0x20, 0x40, 0x40, 0x80, // '}'
+	0x00, 0x00, 0x40, 0xa8, 0x10, 0x00, 0x00, // '~'
+};
+
+static const struct FONT_Glyph font_5x7p_glyphs[] = {
+		{ 0, 0, 3 }, // ' '
+		{ 0, 1, 2 }, // '!'
+		{ 7, 3, 4 }, // '"'
+		{ 14, 5, 6 }, // '#'
+		{ 21, 5, 6 }, // '$'
+		{ 28, 5, 6 }, // '%'
+		{ 35, 5, 6 }, // '&'
+		{ 42, 1, 2 }, // "'"
+		{ 49, 3, 4 }, // '('
+		{ 56, 3, 4 }, // ')'
+		{ 63, 5, 6 }, // '*'
+		{ 70, 5, 6 }, // '+'
+		{ 77, 2, 3 }, // ','
+		{ 84, 5, 6 }, // '-'
+		{ 91, 2, 3 }, // '.'
+		{ 98, 5, 6 }, // '/'
+		{ 105, 5, 6 }, // '0'
+		{ 112, 5, 6 }, // '1'
+		{ 119, 5, 6 }, // '2'
+		{ 126, 5, 6 }, // '3'
+		{ 133, 5, 6 }, // '4'
+		{ 140, 5, 6 }, // '5'
+		{ 147, 5, 6 }, // '6'
+		{ 154, 5, 6 }, // '7'
+		{ 161, 5, 6 }, // '8'
+		{ 168, 5, 6 }, // '9'
+		{ 175, 2, 3 }, // ':'
+		{ 182, 2, 3 }, // ';'
+		{ 189, 4, 5 }, // '<'
+		{ 196, 5, 6 }, // '='
+		{ 203, 4, 5 }, // '>'
+		{ 210, 5, 6 }, // '?'
+		{ 217, 5, 6 }, // '@'
+		{ 224, 5, 6 }, // 'A'
+		{ 231, 5, 6 }, // 'B'
+		{ 238, 5, 6 }, // 'C'
+		{ 245, 5, 6 }, // 'D'
+		{ 252, 5, 6 }, // 'E'
+		{ 259, 5, 6 }, // 'F'
+		{ 266, 5, 6 }, // 'G'
+		{ 273, 5, 6 }, // 'H'
+		{ 280, 3, 4 }, // 'I'
+		{ 287, 5, 6 }, // 'J'
+		{ 294, 5, 6 }, // 'K'
+		{ 301, 5, 6 }, // 'L'
+		{ 308, 5, 6 }, // 'M'
+		{ 315, 5, 6 }, // 'N'
+		{ 322, 5, 6 }, // 'O'
+		{ 329, 5, 6 }, // 'P'
+		{ 336, 5, 6 }, // 'Q'
+		{ 343, 5, 6 }, // 'R'
+		{ 350, 5, 6 }, // 'S'
+		{ 357, 5, 6 }, // 'T'
+		{ 364, 5, 6 }, // 'U'
+		{ 371, 5, 6 }, // 'V'
+		{ 378, 5, 6 }, // 'W'
+		{ 385, 5, 6 }, // 'X'
+		{ 392, 5, 6 }, // 'Y'
+		{ 399, 5, 6 }, // 'Z'
+		{ 406, 3, 4 }, // '['
+		{ 413, 5, 6 }, // '\\'
+		{ 420, 3, 4 }, // ']'
+		{ 427, 5, 6 }, // '^'
+		{ 434, 5, 6 }, // '_'
+		{ 441, 3, 4 }, // '`'
+		{ 448, 5, 6 }, // 'a'
+		{ 455, 5, 6 }, // 'b'
+		{ 462, 5, 6 }, // 'c'
+		{ 469, 5, 6 }, // 'd'
+		{ 476, 5, 6 }, // 'e'
+		{ 483, 5, 6 }, // 'f'
+		{ 490, 5, 6 }, // 'g'
+		{ 497, 5, 6 }, // 'h'
+		{ 504, 3, 4 }, // 'i'
+		{ 511, 4, 5 }, // 'j'
+		{ 518, 4, 5 }, // 'k'
+		{ 525, 3, 4 }, // 'l'
+		{ 532, 5, 6 }, // 'm'
+		{ 539, 5, 6 }, // 'n'
+		{ 546, 5, 6 }, // 'o'
+		{ 553, 5, 6 }, // 'p'
+		{ 560, 5, 6 }, // 'q'
+		{ 567, 5, 6 }, // 'r'
+		{ 574, 5, 6 }, // 's'
+		{ 581, 5, 6 }, // 't'
+		{ 588, 5, 6 }, // 'u'
+		{ 595, 5, 6 }, // 'v'
+		{ 602, 5, 6 }, // 'w'
+		{ 609, 5, 6 }, // 'x'
+		{ 616, 5, 6 }, // 'y'
+		{ 623, 5, 6 }, // 'z'
+		{ 630, 3, 4 }, // '{'
+		{ 637, 1, 2 }, // '|'
+		{ 644, 3, 4 }, // '}'
+		{ 651, 5, 6 }, // '~'
+};
+
+const struct FONT_Font font_5x7p = {
+		.bitmap = font_5x7p_bitmap,
+		.glyphs = font_5x7p_glyphs,
+		.first = 0x20,
+		.last = 0x7e,
+		.width = 5,
+		.advance = 6,
+		.rows = 7,
+		.height = 8,
+};
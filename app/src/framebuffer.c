@@ -0,0 +1,220 @@
+/*
+ * framebuffer.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h>
+#include "framebuffer.h"
+
+// Whole screen in MCU memory, placed in SRAM1 by the linker (.framebuffer section, not initialized)
+// Only linked in when the application uses it
+static uint8_t framebuffer[FB_SIZE] __attribute__((section(".framebuffer"), aligned(4)));
+
+// Damage accumulated since the last flush (last row / columns index is included)
+struct FB_Rect {
+	uint8_t x_start;
+	uint8_t y_start;
+	uint8_t x_end;
+	uint8_t y_end;
+};
+
+static struct FB_Rect dirty[FB_DIRTY_MAX];
+static uint32_t dirty_count = 0;
+
+// Last flush, the framebuffer must not change until DMA is done reading it
+static ST7735_Handle flush_handle = 0;
+
+static uint32_t FB_RectCost(const struct FB_Rect* rect) {
+	const uint32_t area = (rect->x_end - rect->x_start + 1) * (rect->y_end - rect->y_start + 1);
+	return FB_WINDOW_COST + FB_BYTES(area);
+}
+
+static struct FB_Rect FB_RectUnion(const struct FB_Rect* a, const struct FB_Rect* b) {
+	const struct FB_Rect rect = {
+			.x_start = (a->x_start < b->x_start) ? a->x_start : b->x_start,
+			.y_start = (a->y_start < b->y_start) ? a->y_start : b->y_start,
+			.x_end = (a->x_end > b->x_end) ? a->x_end : b->x_end,
+			.y_end = (a->y_end > b->y_end) ? a->y_end : b->y_end,
+	};
+	return rect;
+}
+
+static int32_t FB_MergeGain(const struct FB_Rect* a, const struct FB_Rect* b) {
+	// Bytes saved by sending the bounding box instead of both rectangles
+	// Overlapping or adjacent rectangles usually give a positive gain
+	const struct FB_Rect rect = FB_RectUnion(a, b);
+	return (int32_t)(FB_RectCost(a) + FB_RectCost(b)) - (int32_t)FB_RectCost(&rect);
+}
+
+static void FB_Coalesce(void) {
+	// Merge pairs as long as it doesn't cost more bytes on the bus
+	uint32_t merged = 1;
+
+	while (merged) {
+		merged = 0;
+
+		for (uint32_t i = 0; i < dirty_count && !merged; ++i) {
+			for (uint32_t j = i + 1; j < dirty_count; ++j) {
+				if (FB_MergeGain(&dirty[i], &dirty[j]) < 0) continue;
+
+				dirty[i] = FB_RectUnion(&dirty[i], &dirty[j]);
+				dirty[j] = dirty[--dirty_count];
+				merged = 1;
+				break;
+			}
+		}
+	}
+}
+
+static uint8_t* FB_PixelAddress(const uint8_t x, const uint8_t y) {
+#if FB_FORMAT == 444
+	// First byte holding a part of the pixel (odd pixels start in the middle of a byte)
+	return framebuffer + y * FB_STRIDE + (x * 3) / 2;
+#else
+	return framebuffer + y * FB_STRIDE + FB_BYTES(x);
+#endif
+}
+
+uint32_t FB_Init(void) {
+	// The framebuffer layout follows the controller pixel format
+	if (ST7735_GetPixelFormat() != FB_PIXEL_FORMAT) return 0;
+
+	// and the portrait geometry (ORIENTATION_0 or ORIENTATION_180)
+	if (ST7735_GetWidth() != DISPLAY_WIDTH) return 0;
+
+	memset(framebuffer, 0, sizeof(framebuffer));
+	dirty_count = 0;
+
+	return 1;
+}
+
+uint8_t* FB_GetBuffer(void) {
+	// Rows are FB_STRIDE bytes apart, call FB_MarkDirty after drawing directly into it
+	ST7735_Wait(flush_handle);
+	return framebuffer;
+}
+
+void FB_MarkDirty(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end) {
+	if (x_end < x_start || y_end < y_start || x_start > DISPLAY_WIDTH-1 || y_start > DISPLAY_HEIGHT-1) return;
+
+	struct FB_Rect rect = {
+			.x_start = x_start,
+			.y_start = y_start,
+			.x_end = (x_end > DISPLAY_WIDTH-1) ? DISPLAY_WIDTH-1 : x_end,
+			.y_end = (y_end > DISPLAY_HEIGHT-1) ? DISPLAY_HEIGHT-1 : y_end,
+	};
+
+#if FB_FORMAT == 444
+	// Windows must start and end on a pixel pair so that rows start on a byte
+	rect.x_start &= ~0x01;
+	rect.x_end |= 0x01;
+#endif
+
+	if (dirty_count == FB_DIRTY_MAX) {
+		// No room left : merge with the rectangle that costs the least extra bytes
+		uint32_t best = 0;
+		int32_t best_gain = FB_MergeGain(&dirty[0], &rect);
+
+		for (uint32_t i = 1; i < dirty_count; ++i) {
+			const int32_t gain = FB_MergeGain(&dirty[i], &rect);
+			if (gain > best_gain) {
+				best = i;
+				best_gain = gain;
+			}
+		}
+
+		rect = FB_RectUnion(&dirty[best], &rect);
+		dirty[best] = dirty[--dirty_count];
+	}
+
+	dirty[dirty_count++] = rect;
+
+	FB_Coalesce();
+}
+
+void FB_MarkAllDirty(void) {
+	dirty_count = 0;
+	FB_MarkDirty(0, 0, DISPLAY_WIDTH-1, DISPLAY_HEIGHT-1);
+}
+
+static void FB_WritePixel(const uint8_t x, const uint8_t y, const uint32_t color) {
+	uint8_t* pixel = FB_PixelAddress(x, y);
+
+#if FB_FORMAT == 666
+	*(pixel) = ((color & 0x3F000) >> 12) << 2;
+	*(pixel + 1) = ((color & 0xFC0) >> 6) << 2;
+	*(pixel + 2) = (color & 0x3F) << 2;
+#elif FB_FORMAT == 565
+	*(uint16_t*)pixel = (uint16_t)color;
+#else
+	// Pixel pairs are R0G0 B0R1 G1B1
+	if ((x & 0x01) == 0) {
+		*(pixel) = (uint8_t)(color >> 4);
+		*(pixel + 1) = (*(pixel + 1) & 0x0F) | (uint8_t)((color & 0x00F) << 4);
+	}
+	else {
+		*(pixel) = (*(pixel) & 0xF0) | (uint8_t)((color >> 8) & 0x0F);
+		*(pixel + 1) = (uint8_t)color;
+	}
+#endif
+}
+
+void FB_SetPixel(const uint8_t x, const uint8_t y, const uint32_t color) {
+	if (x > DISPLAY_WIDTH-1 || y > DISPLAY_HEIGHT-1) return;
+
+	ST7735_Wait(flush_handle);
+
+	FB_WritePixel(x, y, color);
+	FB_MarkDirty(x, y, x, y);
+}
+
+void FB_FillRectangle(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end, const uint32_t color) {
+	// Note that last row / columns index is included
+	if (x_end < x_start || y_end < y_start || x_end > DISPLAY_WIDTH-1 || y_end > DISPLAY_HEIGHT-1) return;
+
+	ST7735_Wait(flush_handle);
+
+	for (uint8_t y = y_start; y <= y_end; ++y) {
+		for (uint8_t x = x_start; x <= x_end; ++x) {
+			FB_WritePixel(x, y, color);
+		}
+	}
+
+	FB_MarkDirty(x_start, y_start, x_end, y_end);
+}
+
+void FB_DrawImage(const void* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start) {
+	// Image in the framebuffer format (as generated by frame_gen.py)
+	// In 4-4-4 format, x_start and frame_x_size must be even
+	if (frame_x_size == 0 || frame_y_size == 0) return;
+	if (x_start + frame_x_size > DISPLAY_WIDTH || y_start + frame_y_size > DISPLAY_HEIGHT) return;
+
+	ST7735_Wait(flush_handle);
+
+	const uint8_t* row = (const uint8_t*)buffer;
+	const uint32_t row_size = FB_BYTES(frame_x_size);
+
+	for (uint8_t y = 0; y < frame_y_size; ++y) {
+		memcpy(FB_PixelAddress(x_start, y_start + y), row, row_size);
+		row += row_size;
+	}
+
+	FB_MarkDirty(x_start, y_start, x_start + frame_x_size - 1, y_start + frame_y_size - 1);
+}
+
+ST7735_Handle FB_Flush(void) {
+	// One windowed DMA write per dirty rectangle, rows taken straight from the framebuffer
+	FB_Coalesce();
+
+	for (uint32_t i = 0; i < dirty_count; ++i) {
+		const struct FB_Rect* rect = &dirty[i];
+
+		flush_handle = ST7735_MemoryWriteRegionDMA(framebuffer, FB_STRIDE, rect->x_start, rect->y_start,
+				rect->x_end - rect->x_start + 1, rect->y_end - rect->y_start + 1, rect->x_start, rect->y_start);
+	}
+
+	dirty_count = 0;
+
+	return flush_handle;
+}
@@ -0,0 +1,277 @@
+/*
+ * image.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h>
+#include "image.h"
+
+// QOI ops (see frame_gen.py)
+#define IMG_QOI_OP_INDEX	0x00 // 00xxxxxx
+#define IMG_QOI_OP_DIFF		0x40 // 01rrggbb
+#define IMG_QOI_OP_LUMA		0x80 // 10gggggg rrrrbbbb
+#define IMG_QOI_OP_RUN		0xC0 // 11xxxxxx
+#define IMG_QOI_OP_COLOR	0xFE // full pixel follows
+#define IMG_QOI_OP_MASK		0xC0
+
+// Pixels are handled as driver color values (RED_666, RED_565, RED_444, ...)
+static const struct IMG_Components components_666 = { { 12, 6, 0 }, { 0x3F, 0x3F, 0x3F } };
+static const struct IMG_Components components_565 = { { 11, 5, 0 }, { 0x1F, 0x3F, 0x1F } };
+static const struct IMG_Components components_444 = { { 8, 4, 0 }, { 0x0F, 0x0F, 0x0F } };
+
+const struct IMG_Components* IMG_GetComponents(const enum PIXEL_FORMAT format) {
+	if (format == PIXEL_FORMAT_565) return &components_565;
+	if (format == PIXEL_FORMAT_444) return &components_444;
+	return &components_666;
+}
+
+static uint32_t IMG_ReadColor(struct IMG_Decoder* decoder) {
+	// MSB first, 3 bytes in 6-6-6, 2 bytes otherwise
+	uint32_t color = *(decoder->next++);
+	color = (color << 8) | *(decoder->next++);
+
+	if (decoder->image->format == PIXEL_FORMAT_666) color = (color << 8) | *(decoder->next++);
+
+	return color;
+}
+
+static uint32_t IMG_QOIHash(const struct IMG_Components* components, const uint32_t color) {
+	const uint32_t r = (color >> components->shift[0]) & components->mask[0];
+	const uint32_t g = (color >> components->shift[1]) & components->mask[1];
+	const uint32_t b = (color >> components->shift[2]) & components->mask[2];
+
+	return (r * 3 + g * 5 + b * 7) % IMG_QOI_INDEX_SIZE;
+}
+
+static uint32_t IMG_QOIApplyDiff(const struct IMG_Components* components, const uint32_t color,
+		const int32_t dr, const int32_t dg, const int32_t db) {
+	// Differences wrap around the component range
+	const int32_t diffs[] = { dr, dg, db };
+	uint32_t result = 0;
+
+	for (uint32_t c = 0; c < 3; ++c) {
+		const uint32_t component = ((color >> components->shift[c]) + diffs[c]) & components->mask[c];
+		result |= component << components->shift[c];
+	}
+
+	return result;
+}
+
+static uint32_t IMG_NextRLE(struct IMG_Decoder* decoder) {
+	if (decoder->literals != 0) {
+		decoder->literals--;
+		decoder->previous = IMG_ReadColor(decoder);
+		return decoder->previous;
+	}
+
+	const uint8_t control = *(decoder->next++);
+
+	if (control & 0x80) decoder->run = control & 0x7F;
+	else decoder->literals = control;
+
+	decoder->previous = IMG_ReadColor(decoder);
+	return decoder->previous;
+}
+
+static uint32_t IMG_NextQOI(struct IMG_Decoder* decoder) {
+	const struct IMG_Components* components = IMG_GetComponents(decoder->image->format);
+	const uint8_t op = *(decoder->next++);
+	uint32_t color = decoder->previous;
+
+	if (op == IMG_QOI_OP_COLOR) {
+		color = IMG_ReadColor(decoder);
+	}
+	else if ((op & IMG_QOI_OP_MASK) == IMG_QOI_OP_INDEX) {
+		color = decoder->index[op];
+	}
+	else if ((op & IMG_QOI_OP_MASK) == IMG_QOI_OP_DIFF) {
+		color = IMG_QOIApplyDiff(components, color, ((op >> 4) & 0x03) - 2, ((op >> 2) & 0x03) - 2, (op & 0x03) - 2);
+	}
+	else if ((op & IMG_QOI_OP_MASK) == IMG_QOI_OP_LUMA) {
+		const uint8_t rb = *(decoder->next++);
+		const int32_t dg = (op & 0x3F) - 32;
+		color = IMG_QOIApplyDiff(components, color, dg + (rb >> 4) - 8, dg, dg + (rb & 0x0F) - 8);
+	}
+	else {
+		// Run of x + 1 pixels, this one included
+		decoder->run = op & 0x3F;
+	}
+
+	decoder->index[IMG_QOIHash(components, color)] = color;
+	decoder->previous = color;
+
+	return color;
+}
+
+void IMG_StorePixel(uint8_t* pixels, const uint32_t i, const uint32_t color, const enum PIXEL_FORMAT format) {
+	// Pixel i of a line buffer in the controller format
+	if (format == PIXEL_FORMAT_565) {
+		*((uint16_t*)pixels + i) = (uint16_t)color;
+	}
+	else if (format == PIXEL_FORMAT_444) {
+		// Pixel pairs are R0G0 B0R1 G1B1
+		uint8_t* pixel = pixels + (i * 3) / 2;
+
+		if ((i & 0x01) == 0) {
+			*(pixel) = (uint8_t)(color >> 4);
+			*(pixel + 1) = (*(pixel + 1) & 0x0F) | (uint8_t)((color & 0x00F) << 4);
+		}
+		else {
+			*(pixel) = (*(pixel) & 0xF0) | (uint8_t)((color >> 8) & 0x0F);
+			*(pixel + 1) = (uint8_t)color;
+		}
+	}
+	else {
+		uint8_t* pixel = pixels + i * 3;
+
+		*(pixel) = ((color & 0x3F000) >> 12) << 2;
+		*(pixel + 1) = ((color & 0xFC0) >> 6) << 2;
+		*(pixel + 2) = (color & 0x3F) << 2;
+	}
+}
+
+uint32_t IMG_LoadPixel(const uint8_t* pixels, const uint32_t i, const enum PIXEL_FORMAT format) {
+	// Pixel i of a raw image or line buffer, as a driver color value
+	if (format == PIXEL_FORMAT_565) {
+		return *((const uint16_t*)pixels + i);
+	}
+	else if (format == PIXEL_FORMAT_444) {
+		const uint8_t* pixel = pixels + (i * 3) / 2;
+
+		if ((i & 0x01) == 0) return ((uint32_t)*(pixel) << 4) | (*(pixel + 1) >> 4);
+		return ((uint32_t)(*(pixel) & 0x0F) << 8) | *(pixel + 1);
+	}
+
+	const uint8_t* pixel = pixels + i * 3;
+
+	return ((uint32_t)(*(pixel) >> 2) << 12) | ((uint32_t)(*(pixel + 1) >> 2) << 6) | (*(pixel + 2) >> 2);
+}
+
+uint32_t IMG_ConvertColor(const uint32_t rgb, const enum PIXEL_FORMAT format) {
+	// RGB 8-8-8 (0xRRGGBB) to a driver color value, same rounding as frame_gen.py
+	const uint32_t r = (rgb >> 16) & 0xFF;
+	const uint32_t g = (rgb >> 8) & 0xFF;
+	const uint32_t b = rgb & 0xFF;
+
+	if (format == PIXEL_FORMAT_565) return ((r * 0x1F / 0xFF) << 11) | ((g * 0x3F / 0xFF) << 5) | (b * 0x1F / 0xFF);
+	if (format == PIXEL_FORMAT_444) return ((r * 0x0F / 0xFF) << 8) | ((g * 0x0F / 0xFF) << 4) | (b * 0x0F / 0xFF);
+
+	return (((r * 0xFC / 0xFF) >> 2) << 12) | (((g * 0xFC / 0xFF) >> 2) << 6) | ((b * 0xFC / 0xFF) >> 2);
+}
+
+static void IMG_DecoderRewind(struct IMG_Decoder* decoder) {
+	// Back to the start of the stream (the palette LUT is kept)
+	decoder->next = decoder->image->data;
+	decoder->previous = 0;
+	decoder->run = 0;
+	decoder->literals = 0;
+
+	if (decoder->image->encoding == IMG_ENCODING_QOI) memset(decoder->index, 0, sizeof(decoder->index));
+}
+
+void IMG_DecoderInit(struct IMG_Decoder* decoder, const struct IMG_Image* image) {
+	// Every row is decoded in full, indexed images get their palette converted to the controller format
+	decoder->image = image;
+	decoder->visible_width = image->width;
+
+	if (image->encoding == IMG_ENCODING_INDEXED) {
+		const enum PIXEL_FORMAT format = ST7735_GetPixelFormat();
+		const uint32_t colors = (image->colors > IMG_PALETTE_MAX) ? IMG_PALETTE_MAX : image->colors;
+
+		for (uint32_t i = 0; i < colors; ++i) decoder->lut[i] = IMG_ConvertColor(*(image->palette + i), format);
+		for (uint32_t i = colors; i < IMG_PALETTE_MAX; ++i) decoder->lut[i] = 0;
+	}
+
+	IMG_DecoderRewind(decoder);
+}
+
+static void IMG_DecodeIndexedRows(struct IMG_Decoder* decoder, uint8_t* pixels, const uint32_t rows) {
+	// One LUT lookup per visible pixel, hidden columns are skipped
+	const struct IMG_Image* image = decoder->image;
+	const enum PIXEL_FORMAT format = ST7735_GetPixelFormat();
+	const uint8_t bpp = image->bpp;
+	const uint8_t mask = (uint8_t)((1 << bpp) - 1);
+	const uint32_t row_bytes = (image->width * bpp + 7) / 8;
+	uint32_t i = 0;
+
+	for (uint32_t row = 0; row < rows; ++row) {
+		for (uint32_t x = 0; x < decoder->visible_width; ++x) {
+			const uint32_t bit = x * bpp;
+			const uint8_t index = (*(decoder->next + bit / 8) >> (8 - bpp - (bit % 8))) & mask;
+
+			IMG_StorePixel(pixels, i++, decoder->lut[index], format);
+		}
+
+		decoder->next += row_bytes;
+	}
+}
+
+void IMG_DecodeRows(struct IMG_Decoder* decoder, uint8_t* pixels, const uint32_t rows) {
+	// Decodes the next 'rows' rows into pixels (visible_width pixels per row, packed back to back)
+	// The stream is sequential : rows can't be skipped
+	const struct IMG_Image* image = decoder->image;
+	uint32_t i = 0;
+
+	if (image->encoding == IMG_ENCODING_INDEXED) {
+		IMG_DecodeIndexedRows(decoder, pixels, rows);
+		return;
+	}
+
+	for (uint32_t row = 0; row < rows; ++row) {
+		for (uint32_t x = 0; x < image->width; ++x) {
+			uint32_t color;
+
+			if (decoder->run != 0) {
+				decoder->run--;
+				color = decoder->previous;
+			}
+			else if (image->encoding == IMG_ENCODING_RLE) {
+				color = IMG_NextRLE(decoder);
+			}
+			else {
+				color = IMG_NextQOI(decoder);
+			}
+
+			// Columns past the right edge are decoded but not sent
+			if (x < decoder->visible_width) IMG_StorePixel(pixels, i++, color, image->format);
+		}
+	}
+}
+
+static void IMG_RenderBand(void* context, uint8_t* band, const uint16_t first_line, const uint16_t lines) {
+	// Band renderer, called from the DMA1 Channel 3 ISR in line order
+	struct IMG_Decoder* decoder = (struct IMG_Decoder*)context;
+
+	// First band : the transaction just started
+	if (first_line == 0) IMG_DecoderRewind(decoder);
+
+	IMG_DecodeRows(decoder, band, lines);
+}
+
+ST7735_Handle IMG_DrawDMA(struct IMG_Decoder* decoder, const struct IMG_Image* image, const uint8_t x_start, const uint8_t y_start,
+		uint8_t* buffer, const uint16_t band_lines) {
+	// Compressed images are decoded band_lines rows at a time into one half of buffer
+	// while DMA1 Channel 3 sends the other half, under a single RAMWR
+	// buffer holds 2 * ST7735_GetFrameSize(width * band_lines) bytes (half-word aligned in 5-6-5)
+	// Raw images are sent straight from flash (decoder and buffer are not used)
+	// Indexed images are expanded through their palette, in any pixel format
+
+	// Nothing to queue, handle 0 is always done
+	if (image->encoding != IMG_ENCODING_INDEXED && image->format != ST7735_GetPixelFormat()) return 0;
+	if (x_start >= ST7735_GetWidth() || y_start >= ST7735_GetHeight()) return 0;
+
+	if (image->encoding == IMG_ENCODING_RAW) {
+		return ST7735_MemoryWriteDMA(image->data, image->width, image->height, x_start, y_start);
+	}
+
+	// Clipped to the logical display bounds
+	const uint8_t width = (image->width > ST7735_GetWidth() - x_start) ? ST7735_GetWidth() - x_start : image->width;
+	const uint8_t height = (image->height > ST7735_GetHeight() - y_start) ? ST7735_GetHeight() - y_start : image->height;
+
+	IMG_DecoderInit(decoder, image);
+	decoder->visible_width = width;
+
+	return ST7735_RenderBandsDMA(x_start, y_start, x_start + width - 1, y_start + height - 1,
+			band_lines, buffer, IMG_RenderBand, decoder);
+}
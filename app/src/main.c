@@ -7,12 +7,41 @@
 
 
 #include "main.h"
-#include "smiley_frame.h"
-#include "ffrank_frame.h"
+#include "assets.h"
+#include "asset_pack.h"
+#include "font.h"
+#include "pixel_bench.h"
+#include "blit.h"
+
+// Band height used to decode compressed images
+#define SMILEY_BAND_LINES 8
+
+// Band height and size of the scaled image
+#define THUMB_BAND_LINES 4
+#define THUMB_SIZE 20
 
 static void System_ClockInit(void);
 
-extern __IO uint8_t flag__dma1_channel3_done;
+// QOI compressed smiley, decoded into two bands of SMILEY_BAND_LINES rows while DMA sends the other one
+static struct IMG_Decoder smiley_decoder;
+static uint8_t smiley_bands[2 * SMILEY_WIDTH * SMILEY_BAND_LINES * 3];
+
+// 4x4 white corner mark (RGB 6-6-6) as a command list kept in flash : window, then the pixel data
+// The 48 bytes of pixel data are a long argument run, sent by DMA
+static const uint8_t corner_mark[] = {
+		CASET, 4, 0, DISPLAY_WIDTH-4, 0, DISPLAY_WIDTH-1,
+		RASET, 4, 0, DISPLAY_HEIGHT-4, 0, DISPLAY_HEIGHT-1,
+		RAMWR, 48,
+		0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+		0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+		0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+		0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+		ST7735_CMD_END
+};
+
+// Rotated and scaled copy of ffrank, resampled into two bands of THUMB_BAND_LINES rows
+static struct BLIT_Blitter thumb_blitter;
+static uint8_t thumb_bands[2 * THUMB_SIZE * THUMB_BAND_LINES * 3];
 
 int main(void) {
 
@@ -26,7 +55,8 @@ int main(void) {
 
 	stm32_printf("ST7735 - Debug monitor\r\n");
 
-	ST7735_Init();
+	// Pixel format of the assets (RGB 6-6-6)
+	ST7735_Init(PIXEL_FORMAT_666);
 
 	// Print ST7735 ID1 (Manufacturer ID), ID2 (driver version ID), ID3 (driver ID)
 	uint8_t id_buffer[3] = {0};
@@ -38,30 +68,62 @@ int main(void) {
 	stm32_printf("[INFO] Driver version ID : %d\r\n", id_buffer[1]);
 	stm32_printf("[INFO] Driver ID : %d\r\n", id_buffer[2]);
 
+	// Fastest write clock, reads stay slow
+	const uint32_t spi_clock = ST7735_SetSPIClock(ST7735_SPI_WRITE_MAX_HZ, ST7735_SPI_READ_MAX_HZ);
+	stm32_printf("[INFO] SPI write clock : %d Hz\r\n", spi_clock);
+
 	ST7735_SetBacklight(BL_ON);
 
+	// Asset pack, if one was flashed at the start of the PACK region
+	stm32_printf("[INFO] Asset pack : %d assets\r\n", PACK_Init());
+
+	// Pixel kernels against their C reference, cycles over one line (and whether both outputs match)
+	struct PIX_Result pix_results[8];
+	const uint32_t pix_count = PIX_Benchmark(pix_results, 8);
+	for (uint32_t i = 0; i < pix_count; ++i) {
+		stm32_printf("[INFO] %s : %d cycles (C %d)%s\r\n", pix_results[i].name, pix_results[i].cycles, pix_results[i].reference_cycles,
+				pix_results[i].mismatch ? ", output MISMATCH" : "");
+	}
+
 	// Enable Interrupts
 	ST7735_NVIC_Init();
 
-	// Fill the LCD RAM with data from st7735_frame.c
-	ST7735_MemoryWriteDMA(smiley_buffer, SMILEY_WIDTH, SMILEY_HEIGHT, 0, 0);
+	// Assets are looked up by ID, their pixels stay in flash
+	const struct IMG_Image* smiley = ASSET_Get(ASSET_SMILEY);
+	const struct IMG_Image* ffrank = ASSET_Get(ASSET_FFRANK);
 
-	// Draw some rectangles
+	// Fill the LCD RAM with the smiley, decoded on the fly
+	IMG_DrawDMA(&smiley_decoder, smiley, 0, 0, smiley_bands, SMILEY_BAND_LINES);
+
+	// Draw some rectangles, queued behind the smiley
 	// Note that last row / columns index is included
-	while(flag__dma1_channel3_done == 0);
-	ST7735_DrawRectangle(10, 10, 19, 19, RED_666);
-	ST7735_DrawRectangle(20, 20, 29, 29, GREEN_666);
-	ST7735_DrawRectangle(30, 30, 39, 39, BLUE_666);
+	ST7735_FillRectangleDMA(10, 10, 19, 19, RED_666);
+	ST7735_FillRectangleDMA(20, 20, 29, 29, GREEN_666);
+	const ST7735_Handle rectangles = ST7735_FillRectangleDMA(30, 30, 39, 39, BLUE_666);
+	ST7735_Wait(rectangles);
+
+	// Bottom right corner mark, no RAM buffer needed
+	ST7735_RunCommandList(corner_mark);
 
 	// Write 40x40 pixel image at position (50,50)
-	ST7735_MemoryWrite(ffrank_buffer, FFRANK_WIDTH, FFRANK_HEIGHT, 50, 50);
+	ST7735_MemoryWrite(ffrank->data, ffrank->width, ffrank->height, 50, 50);
+
+	// Write the 20x20 center of the same image at position (100,10), straight from the 40x40 buffer
+	ST7735_MemoryWriteRegionDMA(ffrank->data, ffrank->width*3, 10, 10, 20, 20, 100, 10);
+
+	// The same 40x40 asset rotated by 90 degrees and scaled down to 20x20 at position (100,40), no second copy in flash
+	BLIT_DrawDMA(&thumb_blitter, ffrank, 100, 40, THUMB_SIZE, THUMB_SIZE, BLIT_ROTATION_90, BLIT_FILTER_BILINEAR,
+			thumb_bands, THUMB_BAND_LINES);
+
+	// Label the demo, the whole string is sent in one window
+	FONT_DrawString(&font_5x7p, "ST7735 demo", 2, DISPLAY_HEIGHT-10, GREEN_666, 0, FONT_MODE_FILL);
 
 	// Mirror in X, not in Y
 	ST7735_SetMirror(1, 0);
 
 	// Write same 40x40 pixel image at position (50,100), should be flipped
 	// Note that x' <= 128 - x - frame_x_size
-	ST7735_MemoryWriteDMA(ffrank_buffer, FFRANK_WIDTH, FFRANK_HEIGHT, DISPLAY_WIDTH-50-FFRANK_WIDTH, 100);
+	ST7735_MemoryWriteDMA(ffrank->data, ffrank->width, ffrank->height, DISPLAY_WIDTH-50-ffrank->width, 100);
 
 	while(1) {
 
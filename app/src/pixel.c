@@ -0,0 +1,201 @@
+/*
+ * pixel.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h>
+#include "pixel.h"
+
+#if PIX_SIMD
+// SIMD intrinsics
+#include "stm32l4xx.h"
+#endif
+
+// Channel masks of 4 pixels RGB 8-8-8 read as 3 words (R0 G0 B0 R1, G1 B1 R2 G2, B2 R3 G3 B3)
+// keeping the 5 MSBs of red / blue and the 6 MSBs of green
+static const uint32_t mask_565[3] = { 0xF8F8FCF8, 0xFCF8F8FC, 0xF8FCF8F8 };
+
+// Words of byte buffers are copied rather than read through a uint32_t pointer (strict aliasing),
+// GCC still emits a single LDR / STR
+static inline uint32_t PIX_LoadWord(const uint8_t* bytes) {
+	uint32_t word;
+	memcpy(&word, bytes, 4);
+	return word;
+}
+
+static inline void PIX_StoreWord(uint8_t* bytes, const uint32_t word) {
+	memcpy(bytes, &word, 4);
+}
+
+void PIX_BlendReference(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes, const uint32_t alpha) {
+	for (uint32_t i = 0; i < bytes; ++i) dst[i] = (a[i] * alpha + b[i] * (256 - alpha)) >> 8;
+}
+
+void PIX_FadeReference(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint32_t level) {
+	for (uint32_t i = 0; i < bytes; ++i) dst[i] = (src[i] * level) >> 8;
+}
+
+void PIX_AddSaturateReference(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes) {
+	for (uint32_t i = 0; i < bytes; ++i) {
+		const uint32_t sum = a[i] + b[i];
+		dst[i] = (sum > 0xFF) ? 0xFF : sum;
+	}
+}
+
+void PIX_SubSaturateReference(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes) {
+	for (uint32_t i = 0; i < bytes; ++i) dst[i] = (a[i] > b[i]) ? a[i] - b[i] : 0;
+}
+
+void PIX_ClampReference(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint8_t ceiling) {
+	for (uint32_t i = 0; i < bytes; ++i) dst[i] = (src[i] > ceiling) ? ceiling : src[i];
+}
+
+void PIX_Convert888To666Reference(uint8_t* dst, const uint8_t* src, const uint32_t pixels) {
+	// Truncating, the 6 MSBs of each channel are sent
+	for (uint32_t i = 0; i < pixels * 3; ++i) dst[i] = src[i] & 0xFC;
+}
+
+void PIX_Convert888To565Reference(uint16_t* dst, const uint8_t* src, const uint32_t pixels) {
+	for (uint32_t i = 0; i < pixels; ++i, src += 3) dst[i] = ((src[0] >> 3) << 11) | ((src[1] >> 2) << 5) | (src[2] >> 3);
+}
+
+void PIX_Convert888To444Reference(uint8_t* dst, const uint8_t* src, const uint32_t pixels) {
+	// 2 pixels packed in 3 bytes (R0G0 B0R1 G1B1), an odd last pixel leaves the low nibble of its last byte at 0
+	for (uint32_t i = 0; i < pixels * 3; i += 2) {
+		const uint8_t low = (i + 1 < pixels * 3) ? src[i + 1] >> 4 : 0;
+		dst[i / 2] = (src[i] & 0xF0) | low;
+	}
+}
+
+#if PIX_SIMD
+
+void PIX_Blend(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes, const uint32_t alpha) {
+	// Even and odd channels unpacked to 2 halfword lanes (UXTB16), one multiply weights 2 channels :
+	// a * alpha + b * (256 - alpha) <= 0xFF00, lanes don't carry into each other
+	const uint32_t beta = 256 - alpha;
+	const uint32_t words = bytes / 4;
+
+	for (uint32_t i = 0; i < words; ++i) {
+		const uint32_t wa = PIX_LoadWord(a + i * 4);
+		const uint32_t wb = PIX_LoadWord(b + i * 4);
+
+		const uint32_t even = __UXTB16(wa) * alpha + __UXTB16(wb) * beta;
+		const uint32_t odd = __UXTB16(__ROR(wa, 8)) * alpha + __UXTB16(__ROR(wb, 8)) * beta;
+
+		PIX_StoreWord(dst + i * 4, ((even >> 8) & 0x00FF00FF) | (odd & 0xFF00FF00));
+	}
+
+	PIX_BlendReference(dst + words * 4, a + words * 4, b + words * 4, bytes % 4, alpha);
+}
+
+void PIX_Fade(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint32_t level) {
+	const uint32_t words = bytes / 4;
+
+	for (uint32_t i = 0; i < words; ++i) {
+		const uint32_t w = PIX_LoadWord(src + i * 4);
+
+		const uint32_t even = __UXTB16(w) * level;
+		const uint32_t odd = __UXTB16(__ROR(w, 8)) * level;
+
+		PIX_StoreWord(dst + i * 4, ((even >> 8) & 0x00FF00FF) | (odd & 0xFF00FF00));
+	}
+
+	PIX_FadeReference(dst + words * 4, src + words * 4, bytes % 4, level);
+}
+
+void PIX_AddSaturate(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes) {
+	const uint32_t words = bytes / 4;
+
+	for (uint32_t i = 0; i < words; ++i) PIX_StoreWord(dst + i * 4, __UQADD8(PIX_LoadWord(a + i * 4), PIX_LoadWord(b + i * 4)));
+
+	PIX_AddSaturateReference(dst + words * 4, a + words * 4, b + words * 4, bytes % 4);
+}
+
+void PIX_SubSaturate(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes) {
+	const uint32_t words = bytes / 4;
+
+	for (uint32_t i = 0; i < words; ++i) PIX_StoreWord(dst + i * 4, __UQSUB8(PIX_LoadWord(a + i * 4), PIX_LoadWord(b + i * 4)));
+
+	PIX_SubSaturateReference(dst + words * 4, a + words * 4, b + words * 4, bytes % 4);
+}
+
+void PIX_Clamp(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint8_t ceiling) {
+	// USUB8 sets the GE flag of each channel at or above the ceiling, SEL then picks the ceiling for those
+	const uint32_t ceiling4 = ceiling * 0x01010101UL;
+	const uint32_t words = bytes / 4;
+
+	for (uint32_t i = 0; i < words; ++i) {
+		const uint32_t w = PIX_LoadWord(src + i * 4);
+		(void)__USUB8(w, ceiling4);
+		PIX_StoreWord(dst + i * 4, __SEL(ceiling4, w));
+	}
+
+	PIX_ClampReference(dst + words * 4, src + words * 4, bytes % 4, ceiling);
+}
+
+#else
+
+void PIX_Blend(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes, const uint32_t alpha) {
+	PIX_BlendReference(dst, a, b, bytes, alpha);
+}
+
+void PIX_Fade(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint32_t level) {
+	PIX_FadeReference(dst, src, bytes, level);
+}
+
+void PIX_AddSaturate(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes) {
+	PIX_AddSaturateReference(dst, a, b, bytes);
+}
+
+void PIX_SubSaturate(uint8_t* dst, const uint8_t* a, const uint8_t* b, const uint32_t bytes) {
+	PIX_SubSaturateReference(dst, a, b, bytes);
+}
+
+void PIX_Clamp(uint8_t* dst, const uint8_t* src, const uint32_t bytes, const uint8_t ceiling) {
+	PIX_ClampReference(dst, src, bytes, ceiling);
+}
+
+#endif
+
+// Conversions : 4 pixels (3 words) per iteration, each AND masks 4 channels, no DSP instruction needed
+
+void PIX_Convert888To666(uint8_t* dst, const uint8_t* src, const uint32_t pixels) {
+	const uint32_t words = (pixels / 4) * 3;
+
+	for (uint32_t i = 0; i < words; ++i) PIX_StoreWord(dst + i * 4, PIX_LoadWord(src + i * 4) & 0xFCFCFCFC);
+
+	PIX_Convert888To666Reference(dst + words * 4, src + words * 4, pixels % 4);
+}
+
+void PIX_Convert888To565(uint16_t* dst, const uint8_t* src, const uint32_t pixels) {
+	const uint32_t groups = pixels / 4;
+
+	for (uint32_t i = 0; i < groups; ++i, dst += 4) {
+		const uint8_t* group = src + i * 12;
+		const uint32_t w0 = PIX_LoadWord(group) & mask_565[0];
+		const uint32_t w1 = PIX_LoadWord(group + 4) & mask_565[1];
+		const uint32_t w2 = PIX_LoadWord(group + 8) & mask_565[2];
+
+		dst[0] = ((w0 & 0xFF) << 8) | ((w0 >> 5) & 0x07E0) | ((w0 >> 19) & 0x001F);
+		dst[1] = ((w0 >> 16) & 0xF800) | ((w1 & 0xFF) << 3) | ((w1 >> 11) & 0x001F);
+		dst[2] = ((w1 >> 8) & 0xF800) | ((w1 >> 21) & 0x07E0) | ((w2 & 0xFF) >> 3);
+		dst[3] = (w2 & 0xFF00) | ((w2 >> 13) & 0x07E0) | (w2 >> 27);
+	}
+
+	PIX_Convert888To565Reference(dst, src + groups * 12, pixels % 4);
+}
+
+void PIX_Convert888To444(uint8_t* dst, const uint8_t* src, const uint32_t pixels) {
+	// High nibbles of 4 channels (one word) packed in 2 bytes
+	const uint32_t words = (pixels / 4) * 3;
+
+	for (uint32_t i = 0; i < words; ++i, dst += 2) {
+		const uint32_t w = PIX_LoadWord(src + i * 4) & 0xF0F0F0F0;
+
+		dst[0] = (w & 0xF0) | ((w >> 12) & 0x0F);
+		dst[1] = ((w >> 16) & 0xF0) | (w >> 28);
+	}
+
+	PIX_Convert888To444Reference(dst, src + words * 4, pixels % 4);
+}
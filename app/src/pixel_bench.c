@@ -0,0 +1,68 @@
+/*
+ * pixel_bench.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h>
+#include "pixel_bench.h"
+
+// Benchmark lines, RGB 8-8-8
+static uint8_t bench_a[PIX_BENCH_PIXELS * 3] __attribute__((aligned(4)));
+static uint8_t bench_b[PIX_BENCH_PIXELS * 3] __attribute__((aligned(4)));
+// Kernel and reference outputs, compared after each measurement
+static uint8_t bench_dst[PIX_BENCH_PIXELS * 3] __attribute__((aligned(4)));
+static uint8_t bench_ref[PIX_BENCH_PIXELS * 3] __attribute__((aligned(4)));
+static uint16_t bench_565[PIX_BENCH_PIXELS];
+static uint16_t bench_565_ref[PIX_BENCH_PIXELS];
+
+uint32_t PIX_Benchmark(struct PIX_Result* results, const uint32_t n) {
+	// Cycles of each kernel and of its reference over one line, returns the number of results written
+	// Both outputs start cleared, so bytes a kernel doesn't write can't hide a difference
+	uint32_t count = 0;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	for (uint32_t i = 0; i < sizeof(bench_a); ++i) {
+		bench_a[i] = (uint8_t)(i * 7);
+		bench_b[i] = (uint8_t)(255 - i * 3);
+	}
+
+#define PIX_MEASURE(kernel_name, kernel, reference, output, reference_output) \
+	if (count < n) { \
+		memset(output, 0, sizeof(output)); \
+		memset(reference_output, 0, sizeof(reference_output)); \
+		uint32_t start = DWT->CYCCNT; \
+		kernel; \
+		results[count].cycles = DWT->CYCCNT - start; \
+		start = DWT->CYCCNT; \
+		reference; \
+		results[count].reference_cycles = DWT->CYCCNT - start; \
+		results[count].mismatch = (memcmp(output, reference_output, sizeof(output)) != 0); \
+		results[count++].name = kernel_name; \
+	}
+
+	const uint32_t bytes = sizeof(bench_a);
+
+	PIX_MEASURE("blend", PIX_Blend(bench_dst, bench_a, bench_b, bytes, 96),
+			PIX_BlendReference(bench_ref, bench_a, bench_b, bytes, 96), bench_dst, bench_ref);
+	PIX_MEASURE("fade", PIX_Fade(bench_dst, bench_a, bytes, 160),
+			PIX_FadeReference(bench_ref, bench_a, bytes, 160), bench_dst, bench_ref);
+	PIX_MEASURE("add sat", PIX_AddSaturate(bench_dst, bench_a, bench_b, bytes),
+			PIX_AddSaturateReference(bench_ref, bench_a, bench_b, bytes), bench_dst, bench_ref);
+	PIX_MEASURE("sub sat", PIX_SubSaturate(bench_dst, bench_a, bench_b, bytes),
+			PIX_SubSaturateReference(bench_ref, bench_a, bench_b, bytes), bench_dst, bench_ref);
+	PIX_MEASURE("clamp", PIX_Clamp(bench_dst, bench_a, bytes, 0xC0),
+			PIX_ClampReference(bench_ref, bench_a, bytes, 0xC0), bench_dst, bench_ref);
+	PIX_MEASURE("888>666", PIX_Convert888To666(bench_dst, bench_a, PIX_BENCH_PIXELS),
+			PIX_Convert888To666Reference(bench_ref, bench_a, PIX_BENCH_PIXELS), bench_dst, bench_ref);
+	PIX_MEASURE("888>565", PIX_Convert888To565(bench_565, bench_a, PIX_BENCH_PIXELS),
+			PIX_Convert888To565Reference(bench_565_ref, bench_a, PIX_BENCH_PIXELS), bench_565, bench_565_ref);
+	PIX_MEASURE("888>444", PIX_Convert888To444(bench_dst, bench_a, PIX_BENCH_PIXELS),
+			PIX_Convert888To444Reference(bench_ref, bench_a, PIX_BENCH_PIXELS), bench_dst, bench_ref);
+
+#undef PIX_MEASURE
+
+	return count;
+}
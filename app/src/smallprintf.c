@@ -25,6 +25,15 @@
 */
 
 #include "stm32l4xx.h"
+#include "console.h"
+
+/* stm32_printf outputs, UART and / or the on-panel console */
+static int printf_output = PRINTF_OUTPUT_UART;
+
+void stm32_printf_output(int output)
+{
+	printf_output = output;
+}
 
 static void printchar(char **str, int c)
 {
@@ -33,8 +42,11 @@ static void printchar(char **str, int c)
 		++(*str);
 	}
 	else  {
-		while((USART2->ISR & USART_ISR_TC) != USART_ISR_TC);
-		USART2->TDR = (uint8_t)c;
+		if (printf_output & PRINTF_OUTPUT_UART) {
+			while((USART2->ISR & USART_ISR_TC) != USART_ISR_TC);
+			USART2->TDR = (uint8_t)c;
+		}
+		if (printf_output & PRINTF_OUTPUT_LCD) CONSOLE_PutChar(c);
 	}
 }
 
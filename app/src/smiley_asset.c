@@ -0,0 +1,161 @@
+/*
+ * smiley_asset.c
+ *
+ *  Generated by frame_gen.py, do not edit
+ */
+// asset : smiley 128 160
+
+#include "assets.h"
+
+static const uint8_t smiley_data[] __attribute__((section(".assets"), aligned(ASSET_ALIGN))) = {
+	0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd6, 0xa2, 0x86, 0x7e, 0x7a, 0xc0, 0x18, 0x10, 0x00, 0xfd, 0xf3, 0xa6, 0x83, 0xa8, 0xa1, 0xa9, 0x91, 0xa7, 0xa3,
+	0xa7, 0x82, 0xa5, 0x94, 0xa3, 0x96, 0xa3, 0x85, 0xa2, 0x87, 0xc2, 0x14, 0x3c, 0x1a, 0x28, 0x29, 0x1d, 0x04, 0xfe, 0x00, 0x61, 0x41, 0x00, 0xfd, 0xe8, 0xa6, 0x93, 0xfe, 0x01, 0x54, 0xc3, 0xfe,
+	0x02, 0x58, 0x06, 0xfe, 0x03, 0x2b, 0x08, 0xa8, 0x92, 0xa4, 0x85, 0x6e, 0xc1, 0x22, 0x66, 0xc0, 0x5a, 0x66, 0xc0, 0x1a, 0x1d, 0xc0, 0x22, 0x27, 0xc1, 0x22, 0x3b, 0x2a, 0x39, 0xfe, 0x01, 0x64,
+	0xc3, 0x3a, 0x00, 0xfd, 0xe1, 0x3a, 0xfe, 0x01, 0x95, 0x84, 0xfe, 0x02, 0xda, 0x08, 0x3b, 0x27, 0xc0, 0x22, 0x51, 0x56, 0x5a, 0xc2, 0x06, 0xc6, 0x03, 0xc2, 0x06, 0x0e, 0x22, 0x27, 0xc0, 0x3b,
+	0x07, 0xfe, 0x01, 0xa5, 0xc4, 0x3a, 0x00, 0xfd, 0xdc, 0xfe, 0x01, 0x24, 0x03, 0x28, 0xfe, 0x03, 0xad, 0x0a, 0x27, 0x22, 0x0e, 0x03, 0xc0, 0x06, 0xc0, 0x6e, 0xd0, 0x06, 0xc0, 0x03, 0xc0, 0x0e,
+	0x22, 0x27, 0x3b, 0x28, 0x1b, 0x00, 0xfd, 0xd7, 0x10, 0xfe, 0x01, 0x85, 0x44, 0xfe, 0x03, 0x1b, 0x08, 0x22, 0x6e, 0x0e, 0x03, 0xc0, 0x06, 0x0b, 0xd8, 0x06, 0x03, 0xc0, 0x0e, 0x27, 0x22, 0x2a,
+	0x0d, 0x10, 0x00, 0xfd, 0xd2, 0x7e, 0x15, 0xfe, 0x03, 0x4b, 0xc9, 0x27, 0x22, 0x9d, 0x9a, 0x03, 0x06, 0x0b, 0xde, 0x06, 0x03, 0x06, 0x22, 0x27, 0xfe, 0x03, 0x5b, 0xc9, 0x15, 0x08, 0x00, 0xfd,
+	0xcf, 0xfe, 0x01, 0x34, 0x43, 0xfe, 0x03, 0x2b, 0x49, 0x27, 0x62, 0x03, 0x06, 0x0b, 0xe4, 0x06, 0x03, 0x1d, 0x27, 0xfe, 0x03, 0x3b, 0x49, 0xfe, 0x01, 0x44, 0x43, 0x00, 0xfd, 0xcc, 0xa8, 0x91,
+	0xfe, 0x02, 0xa9, 0x87, 0x22, 0xc0, 0x03, 0x06, 0x0b, 0xe8, 0x06, 0x03, 0x22, 0xc0, 0x2d, 0x0a, 0x00, 0xfd, 0xc9, 0xfe, 0x01, 0xb5, 0xc4, 0x3b, 0x27, 0x03, 0x06, 0x0b, 0xec, 0x06, 0x03, 0x27,
+	0x3b, 0x20, 0x00, 0xfd, 0xc6, 0x3a, 0xfe, 0x02, 0xc9, 0xc7, 0x27, 0x0e, 0x03, 0x0b, 0xf0, 0x03, 0x0e, 0x27, 0xfe, 0x02, 0xca, 0x08, 0x3a, 0x00, 0xfd, 0xc3, 0x23, 0xfe, 0x03, 0x8c, 0x8a, 0x27,
+	0x03, 0x06, 0x0b, 0xf2, 0x06, 0x03, 0x27, 0x2b, 0xfe, 0x01, 0x34, 0x03, 0x00, 0xfd, 0xc1, 0xfe, 0x01, 0xe6, 0xc5, 0x22, 0x1a, 0x03, 0x0b, 0xf6, 0x03, 0x1a, 0x22, 0xfe, 0x01, 0xf6, 0xc5, 0x00,
+	0xfc, 0x08, 0xfe, 0x02, 0x88, 0xc7, 0xfe, 0x03, 0xfe, 0x8b, 0x06, 0xc0, 0x0b, 0xf8, 0x06, 0xc0, 0x2c, 0xfe, 0x02, 0x89, 0x07, 0x08, 0x00, 0xf9, 0xa4, 0x94, 0xfe, 0x02, 0xfa, 0x88, 0x2c, 0x03,
+	0x06, 0x0b, 0xfa, 0x06, 0x03, 0x2c, 0x17, 0x23, 0x00, 0xf7, 0x3a, 0xfe, 0x03, 0x3b, 0x89, 0x27, 0x03, 0x0b, 0xfd, 0xc0, 0x52, 0x27, 0x39, 0x3a, 0x00, 0xf5, 0xa7, 0x92, 0x09, 0x22, 0x03, 0x0b,
+	0xfd, 0xc2, 0x03, 0x27, 0x09, 0x02, 0x00, 0xf3, 0x3a, 0xfe, 0x03, 0x6c, 0x09, 0x22, 0x03, 0x0b, 0xfd, 0xc4, 0x03, 0x22, 0x11, 0x3a, 0x00, 0xf1, 0xa5, 0x83, 0xfe, 0x03, 0x4b, 0x89, 0x22, 0x03,
+	0x0b, 0xfd, 0xc6, 0x03, 0x22, 0x97, 0x6f, 0x28, 0x00, 0xef, 0xa2, 0x96, 0xfe, 0x03, 0x1b, 0x08, 0xfe, 0x03, 0xfe, 0x4b, 0x03, 0x0b, 0xfd, 0xc8, 0x03, 0x27, 0xfe, 0x03, 0x1b, 0x08, 0x13, 0x00,
+	0xee, 0x38, 0xfe, 0x03, 0xfe, 0x4b, 0x3e, 0x0b, 0xfd, 0xca, 0x03, 0x27, 0x38, 0x00, 0xed, 0xfe, 0x02, 0x37, 0xc6, 0x2c, 0x03, 0x0b, 0xfd, 0xcc, 0x03, 0x2c, 0xfe, 0x02, 0x47, 0xc6, 0x00, 0xeb,
+	0xfe, 0x01, 0x95, 0x44, 0x27, 0x03, 0x0b, 0xfd, 0xce, 0x03, 0x27, 0x10, 0x00, 0xe9, 0xfe, 0x00, 0xd2, 0xc2, 0xfe, 0x03, 0xdd, 0x8b, 0x0b, 0x66, 0x0b, 0xfd, 0xce, 0x06, 0x0b, 0x12, 0x2c, 0x00,
+	0xe7, 0xa3, 0x85, 0x09, 0xa9, 0x81, 0x03, 0x0b, 0xfd, 0xd0, 0x06, 0x1f, 0x97, 0x9f, 0x18, 0x00, 0xe6, 0xfe, 0x02, 0x88, 0xc7, 0x27, 0x03, 0x0b, 0xfd, 0xd2, 0x03, 0x27, 0x18, 0x00, 0xe5, 0xfe,
+	0x01, 0x64, 0xc3, 0x27, 0x03, 0x0b, 0xfd, 0xd4, 0x03, 0x27, 0x36, 0x00, 0xe3, 0x32, 0xfe, 0x03, 0x9c, 0xca, 0x1a, 0x06, 0x0b, 0xfd, 0xd4, 0x06, 0x1a, 0x30, 0x32, 0x00, 0xe2, 0xfe, 0x02, 0xa9,
+	0x07, 0x27, 0x03, 0x0b, 0xfd, 0xd6, 0x03, 0x27, 0x23, 0x00, 0xe1, 0xfe, 0x01, 0x34, 0x43, 0x27, 0x03, 0x0b, 0xfd, 0xd8, 0x03, 0x27, 0x23, 0x00, 0xdf, 0xa2, 0x86, 0x0c, 0x1a, 0x06, 0x0b, 0xfd,
+	0xd8, 0x06, 0x1a, 0x09, 0x10, 0x00, 0xde, 0x04, 0xfe, 0x03, 0xfe, 0x8b, 0x03, 0x0b, 0xfd, 0xda, 0x03, 0x2c, 0xfe, 0x01, 0xe6, 0x85, 0x00, 0xdd, 0x3a, 0x3b, 0x0b, 0x06, 0x0b, 0xfd, 0xda, 0x06,
+	0x0b, 0x3b, 0x3a, 0x00, 0xdc, 0xfe, 0x02, 0x58, 0x46, 0x27, 0x03, 0x0b, 0xfd, 0xdc, 0x03, 0x27, 0xfe, 0x02, 0x58, 0x06, 0x00, 0xdb, 0xa8, 0xa1, 0xfe, 0x03, 0xcd, 0x8a, 0x0b, 0xfd, 0xe1, 0x0a,
+	0x00, 0xda, 0xfe, 0x02, 0x78, 0x87, 0x27, 0x03, 0x0b, 0xfd, 0xde, 0x03, 0x27, 0xfe, 0x02, 0x78, 0x86, 0x00, 0xd9, 0x0a, 0x08, 0x0b, 0xfd, 0xe2, 0x08, 0x0a, 0x00, 0xd8, 0x39, 0x27, 0x03, 0x0b,
+	0xfd, 0xe0, 0x03, 0x27, 0x39, 0x00, 0xd7, 0x32, 0x3b, 0x0e, 0x06, 0x0b, 0xfd, 0xe0, 0x06, 0x0e, 0x3b, 0x32, 0x00, 0xd6, 0x3f, 0x2c, 0x03, 0x0b, 0xfd, 0xe2, 0x03, 0x2c, 0x3f, 0x00, 0xd5, 0xa1,
+	0x97, 0x0c, 0x1a, 0x06, 0x6e, 0xfd, 0xe2, 0x06, 0x1a, 0x98, 0x7e, 0xfe, 0x00, 0x10, 0x40, 0x00, 0xd4, 0x26, 0x27, 0x03, 0x0b, 0xfd, 0xe4, 0x03, 0x27, 0x23, 0x00, 0xd4, 0xfe, 0x02, 0xb9, 0x87,
+	0x27, 0x03, 0x0b, 0xfd, 0xe4, 0x03, 0x27, 0x30, 0x00, 0xd3, 0x3a, 0x03, 0x0e, 0x0b, 0xfd, 0xe6, 0x0e, 0x42, 0x3a, 0x00, 0xd2, 0xfe, 0x01, 0xb6, 0x04, 0x27, 0x03, 0x0b, 0xd8, 0x03, 0xc0, 0x0b,
+	0xd8, 0x06, 0x03, 0xc0, 0x06, 0x0b, 0xea, 0x03, 0x27, 0x25, 0x00, 0xd2, 0x17, 0x22, 0x03, 0x0b, 0xd6, 0x06, 0x0b, 0x27, 0x22, 0x06, 0x0b, 0xd6, 0x06, 0x0e, 0x27, 0xc0, 0x1a, 0x06, 0x0b, 0xe9,
+	0x03, 0x22, 0x17, 0x00, 0xd1, 0x0a, 0x0b, 0xd8, 0x06, 0x1a, 0x0e, 0x30, 0xa2, 0x87, 0xfe, 0x03, 0xfd, 0xcb, 0x0b, 0xd5, 0x06, 0x1a, 0x3e, 0xfe, 0x02, 0x17, 0x45, 0x9d, 0x7b, 0xfe, 0x03, 0x8c,
+	0x4a, 0x1a, 0x06, 0x0b, 0xea, 0x06, 0x0a, 0x00, 0xd0, 0x25, 0x27, 0x03, 0x0b, 0xd5, 0x06, 0x12, 0x45, 0xfe, 0x01, 0x13, 0xc3, 0xfe, 0x00, 0x00, 0x00, 0xc0, 0x3c, 0x22, 0x06, 0x0b, 0xd2, 0x06,
+	0x12, 0x3b, 0xfe, 0x00, 0xe3, 0x02, 0x00, 0xc0, 0xa9, 0x90, 0x3b, 0x0b, 0x06, 0x0b, 0xe8, 0x03, 0x27, 0x25, 0x00, 0xd0, 0x07, 0x22, 0x03, 0x0b, 0xd5, 0x06, 0x22, 0xfe, 0x01, 0x54, 0x83, 0x00,
+	0x08, 0x00, 0xc0, 0xfe, 0x03, 0x0a, 0x88, 0x1f, 0x03, 0x0b, 0xd1, 0x06, 0x27, 0x36, 0x00, 0x08, 0xc0, 0x00, 0xfe, 0x02, 0x07, 0x05, 0x27, 0x03, 0x0b, 0xe8, 0x03, 0x22, 0x07, 0x00, 0xcf, 0x28,
+	0xfe, 0x03, 0xac, 0xca, 0xa3, 0x96, 0x06, 0x0b, 0xd4, 0x03, 0x27, 0x30, 0x00, 0x7a, 0x00, 0xc1, 0xfe, 0x01, 0x85, 0x44, 0x27, 0x9c, 0x9b, 0x0b, 0xd0, 0x03, 0x22, 0xfe, 0x02, 0xea, 0x08, 0x00,
+	0xc3, 0x12, 0x0b, 0xea, 0x06, 0x15, 0x33, 0x28, 0x00, 0xce, 0x26, 0x27, 0x03, 0x0b, 0xd5, 0x06, 0xa2, 0x77, 0xfe, 0x00, 0xd2, 0xc2, 0x00, 0xc3, 0xa7, 0xa2, 0x03, 0x0b, 0xd1, 0x06, 0x22, 0x13,
+	0x00, 0xc4, 0x01, 0x1d, 0x06, 0x0b, 0xe8, 0x03, 0x27, 0x26, 0x00, 0xce, 0x31, 0x27, 0x03, 0x0b, 0xd4, 0x03, 0x22, 0xfe, 0x02, 0xfa, 0x88, 0x00, 0xc4, 0x08, 0x09, 0x1d, 0x06, 0x0b, 0xce, 0x06,
+	0x22, 0xfe, 0x03, 0x4b, 0x49, 0xfe, 0x00, 0x10, 0x00, 0x00, 0xc4, 0xfe, 0x02, 0xa9, 0x47, 0x27, 0x9c, 0x9b, 0x0b, 0xe8, 0x03, 0x27, 0x31, 0x00, 0xce, 0x2a, 0x22, 0x06, 0x0b, 0xd4, 0x03, 0x27,
+	0xfe, 0x01, 0xa5, 0xc4, 0x00, 0xc5, 0xfe, 0x02, 0xea, 0x48, 0x22, 0x03, 0x0b, 0xce, 0x03, 0x27, 0xfe, 0x02, 0x17, 0x45, 0x00, 0xc5, 0xfe, 0x02, 0x37, 0xc6, 0x27, 0x03, 0x0b, 0xe8, 0x06, 0x22,
+	0x2a, 0x00, 0xcd, 0x3a, 0x3e, 0x15, 0x06, 0x0b, 0xd6, 0xfe, 0x00, 0x92, 0x01, 0x00, 0xc5, 0xfe, 0x02, 0x99, 0x07, 0x27, 0x03, 0x0b, 0xce, 0x06, 0x1f, 0xfe, 0x01, 0x03, 0x82, 0x00, 0xc5, 0x3f,
+	0x27, 0x03, 0x0b, 0xe8, 0x06, 0x15, 0x3b, 0x3a, 0x00, 0xcc, 0xfe, 0x01, 0x34, 0x43, 0x27, 0x03, 0x0b, 0xd4, 0x06, 0x22, 0x3c, 0x00, 0xc6, 0xfe, 0x02, 0x78, 0x86, 0x27, 0x03, 0x0b, 0xcd, 0x06,
+	0x1a, 0x2b, 0xfe, 0x00, 0x40, 0xc0, 0x00, 0xc5, 0xfe, 0x01, 0xc6, 0x04, 0x27, 0x03, 0x0b, 0xe9, 0x03, 0x27, 0x1e, 0x00, 0xcc, 0xfe, 0x02, 0x07, 0x05, 0x27, 0x03, 0x0b, 0xd4, 0x03, 0x27, 0x18,
+	0x00, 0xc6, 0x09, 0x27, 0x03, 0x0b, 0xcd, 0x03, 0x22, 0xfe, 0x02, 0xfa, 0x88, 0x00, 0xc6, 0xfe, 0x01, 0xc6, 0x44, 0x27, 0x03, 0x0b, 0xe9, 0x03, 0x27, 0x0f, 0x00, 0xcc, 0xfe, 0x02, 0xc9, 0x87,
+	0x27, 0x03, 0x0b, 0xd4, 0x03, 0x27, 0xfe, 0x01, 0xd6, 0x85, 0x00, 0xc6, 0x20, 0x27, 0x03, 0x0b, 0xcd, 0x03, 0x27, 0xfe, 0x02, 0x68, 0x46, 0x00, 0xc6, 0xfe, 0x01, 0xf6, 0xc5, 0x27, 0x03, 0x0b,
+	0xe9, 0x03, 0x27, 0x30, 0x00, 0xcb, 0x08, 0xfe, 0x03, 0x5b, 0xc9, 0xa8, 0xa2, 0x06, 0x0b, 0xd4, 0x03, 0x27, 0xfe, 0x01, 0x54, 0x83, 0x00, 0xc6, 0x38, 0x27, 0x03, 0x0b, 0xcd, 0x03, 0x27, 0x3c,
+	0x00, 0xc6, 0xfe, 0x02, 0x37, 0xc6, 0x27, 0x03, 0x0b, 0xe9, 0x06, 0x1d, 0x09, 0x08, 0x00, 0xca, 0x02, 0x03, 0x0e, 0x06, 0x0b, 0xd4, 0x06, 0x22, 0x34, 0x00, 0xc6, 0x2a, 0x22, 0x06, 0x0b, 0xcd,
+	0x03, 0x27, 0xfe, 0x01, 0x75, 0x04, 0x00, 0xc6, 0xfe, 0x02, 0xa9, 0x47, 0x27, 0x03, 0x0b, 0xe9, 0x06, 0x0e, 0x03, 0x02, 0x00, 0xca, 0x04, 0x22, 0x06, 0x0b, 0xd7, 0x12, 0x00, 0xc5, 0xa2, 0x96,
+	0xfe, 0x03, 0x8c, 0x49, 0x1a, 0x06, 0x0b, 0xcd, 0x03, 0x22, 0x23, 0x00, 0xc6, 0xfe, 0x03, 0x2a, 0xc8, 0x22, 0x06, 0x0b, 0xea, 0x06, 0x22, 0x04, 0x00, 0xca, 0xfe, 0x01, 0x95, 0x84, 0x27, 0x03,
+	0x0b, 0xd4, 0x06, 0x0e, 0x03, 0x02, 0x00, 0xc5, 0x12, 0x0b, 0xd0, 0x06, 0x22, 0xfe, 0x01, 0x13, 0xc2, 0x00, 0xc5, 0xa4, 0x84, 0x2b, 0x1a, 0x06, 0x0b, 0xea, 0x03, 0x27, 0x15, 0x00, 0xca, 0xfe,
+	0x02, 0x27, 0x86, 0x27, 0x03, 0x0b, 0xd4, 0x06, 0x0e, 0x03, 0x02, 0x00, 0xc5, 0xfe, 0x01, 0x54, 0xc3, 0x27, 0x03, 0x0b, 0xce, 0x06, 0x22, 0x0c, 0x00, 0xc5, 0xfe, 0x00, 0xe3, 0x42, 0x1a, 0x06,
+	0x0b, 0xeb, 0x03, 0x27, 0x26, 0x00, 0xca, 0x28, 0x27, 0x03, 0x0b, 0xd6, 0x06, 0x0a, 0x00, 0xc5, 0xfe, 0x02, 0x48, 0x06, 0x27, 0x03, 0x0b, 0xce, 0x03, 0x27, 0x23, 0x00, 0xc5, 0x3c, 0xfe, 0x03,
+	0xfe, 0x8b, 0x03, 0x0b, 0xeb, 0x03, 0x27, 0x28, 0x00, 0xca, 0xfe, 0x03, 0x0a, 0x88, 0x22, 0x06, 0x0b, 0xd5, 0x06, 0x1d, 0xfe, 0x00, 0xd2, 0xc2, 0x00, 0xc4, 0x7a, 0xfe, 0x03, 0x4b, 0x49, 0x1d,
+	0x06, 0x0b, 0xce, 0x56, 0x27, 0x0d, 0x00, 0xc5, 0xfe, 0x02, 0xfa, 0x48, 0x22, 0x03, 0x0b, 0xeb, 0x06, 0x22, 0x1a, 0x00, 0xc9, 0x08, 0xfe, 0x03, 0x6b, 0xc9, 0x1d, 0x06, 0x0b, 0xd5, 0x03, 0x27,
+	0xfe, 0x01, 0x44, 0x43, 0x00, 0xc4, 0x34, 0xfe, 0x03, 0xed, 0xcb, 0x06, 0x0b, 0xcf, 0x03, 0x27, 0xfe, 0x02, 0x17, 0x45, 0x00, 0xc4, 0x0a, 0x0b, 0xee, 0x06, 0x1d, 0x09, 0x08, 0x00, 0xc8, 0x20,
+	0xfe, 0x03, 0xac, 0xca, 0xa3, 0x96, 0x06, 0x0b, 0xd5, 0x03, 0xa5, 0x64, 0x07, 0x00, 0xc4, 0x01, 0x27, 0x03, 0x0b, 0xcf, 0x03, 0x27, 0x38, 0x00, 0xc4, 0x17, 0x27, 0x03, 0x0b, 0xec, 0x06, 0x15,
+	0x2b, 0x20, 0x00, 0xc8, 0xa7, 0xa2, 0x03, 0x0b, 0x06, 0x0b, 0xd5, 0x03, 0x22, 0xfe, 0x02, 0xea, 0x48, 0x00, 0xc3, 0xa7, 0x82, 0xfe, 0x03, 0xbd, 0x4a, 0x0b, 0x06, 0x0b, 0xcf, 0x06, 0x15, 0x2b,
+	0x1b, 0x9d, 0x7b, 0xc2, 0xa5, 0x83, 0x33, 0x15, 0x06, 0x0b, 0xec, 0x06, 0x0b, 0x03, 0x02, 0x00, 0xc8, 0xfe, 0x00, 0xc2, 0xc2, 0x1a, 0x06, 0x0b, 0xd9, 0x0a, 0x00, 0x08, 0x66, 0x00, 0xfe, 0x02,
+	0x99, 0x07, 0x27, 0x9c, 0x9b, 0x0b, 0xd1, 0x03, 0x27, 0xfe, 0x01, 0x95, 0x84, 0x00, 0x08, 0x00, 0xc0, 0x18, 0x27, 0x03, 0x0b, 0xee, 0x06, 0x1a, 0xfe, 0x00, 0xc2, 0x82, 0x00, 0xc8, 0x04, 0x22,
+	0x06, 0x0b, 0xd7, 0x03, 0x27, 0xfe, 0x02, 0xa9, 0x47, 0x00, 0xc1, 0x2d, 0x27, 0x06, 0x0b, 0xd2, 0x06, 0x1a, 0x9b, 0x7c, 0x0a, 0x00, 0xc0, 0x07, 0x27, 0x06, 0x0b, 0xef, 0x06, 0x22, 0xfe, 0x00,
+	0xf3, 0x42, 0x00, 0xc8, 0x1e, 0x22, 0x03, 0x0b, 0xd8, 0x06, 0x22, 0xfe, 0x02, 0xa9, 0x47, 0x0d, 0x18, 0x22, 0x0b, 0xd5, 0x06, 0x1a, 0x2b, 0x01, 0x12, 0x22, 0x06, 0x0b, 0xf0, 0x03, 0x22, 0x1e,
+	0x00, 0xc8, 0xfe, 0x01, 0x54, 0xc3, 0x27, 0x03, 0x0b, 0xd9, 0x06, 0x22, 0x27, 0xc0, 0x06, 0x0b, 0xd6, 0x06, 0x7f, 0x27, 0x22, 0x06, 0x0b, 0xf1, 0x03, 0x27, 0xfe, 0x01, 0x54, 0x83, 0x00, 0xc8,
+	0xfe, 0x01, 0x75, 0x04, 0x27, 0x03, 0x0b, 0xda, 0x03, 0xc1, 0x0b, 0xd8, 0x06, 0x03, 0xc0, 0x0b, 0xf2, 0x03, 0x27, 0xfe, 0x01, 0x75, 0x03, 0x00, 0xc8, 0x0d, 0x27, 0x03, 0x0b, 0xfd, 0xf0, 0x03,
+	0x27, 0x0d, 0x00, 0xc8, 0xfe, 0x01, 0x95, 0x84, 0x27, 0x03, 0x0b, 0xfd, 0xf0, 0x03, 0x27, 0x15, 0x00, 0xc8, 0x15, 0x27, 0x03, 0x0b, 0xfd, 0xf0, 0x03, 0x27, 0x15, 0x00, 0xc8, 0x0d, 0x27, 0x03,
+	0x0b, 0xfd, 0xf0, 0x03, 0x27, 0x0d, 0x00, 0xc8, 0x05, 0x27, 0x03, 0x0b, 0xfd, 0xf0, 0x03, 0x27, 0x3e, 0x00, 0xc8, 0x33, 0x27, 0x03, 0x0b, 0xfd, 0xf0, 0x03, 0x27, 0x2e, 0x00, 0xc8, 0x1e, 0x22,
+	0x03, 0x0b, 0xfd, 0xf0, 0x03, 0x22, 0x1e, 0x00, 0xc8, 0x04, 0x22, 0x06, 0x0b, 0xc9, 0x06, 0xc0, 0x0b, 0xfd, 0xcb, 0x03, 0x0b, 0xd5, 0x06, 0x22, 0x3c, 0x00, 0xc8, 0x24, 0x1a, 0x06, 0x0b, 0xc8,
+	0x06, 0x1a, 0x0e, 0x06, 0x0b, 0xfd, 0xca, 0x27, 0x0b, 0x06, 0x0b, 0xd3, 0x06, 0x1a, 0x24, 0x00, 0xc8, 0xa7, 0xa2, 0x03, 0x0b, 0x06, 0x0b, 0xc6, 0x06, 0x22, 0x2b, 0xa1, 0x97, 0x0e, 0x0b, 0xfd,
+	0xc8, 0x0e, 0x3b, 0x28, 0x06, 0x0b, 0xd3, 0x06, 0x0b, 0x03, 0x02, 0x00, 0xc8, 0xa4, 0x84, 0xfe, 0x03, 0xac, 0xca, 0xa3, 0x96, 0x06, 0x0b, 0xc5, 0x06, 0x1f, 0xfe, 0x03, 0x3b, 0x49, 0xfe, 0x00,
+	0x51, 0x40, 0xfe, 0x02, 0x37, 0x86, 0x2c, 0x03, 0x0b, 0xfd, 0xc6, 0x03, 0x22, 0x12, 0x00, 0xfe, 0x01, 0xb6, 0x04, 0x27, 0x06, 0x0b, 0xd1, 0x06, 0x15, 0x2b, 0x20, 0x00, 0xc8, 0x08, 0x0c, 0x1d,
+	0x06, 0x0b, 0xc4, 0x06, 0x0b, 0x03, 0xfe, 0x00, 0xa2, 0x41, 0x00, 0xfe, 0x01, 0x54, 0xc3, 0x27, 0x03, 0x0b, 0xfd, 0xc6, 0x03, 0x27, 0xfe, 0x02, 0x27, 0x86, 0x00, 0xc0, 0xfe, 0x02, 0xfa, 0x88,
+	0x1f, 0x03, 0x0b, 0xd0, 0x06, 0x1d, 0x09, 0x08, 0x00, 0xc9, 0xfe, 0x03, 0x0a, 0x88, 0x22, 0x06, 0x0b, 0xc4, 0x03, 0x2c, 0xfe, 0x02, 0x17, 0x45, 0x00, 0xc0, 0x34, 0x1d, 0x06, 0x0b, 0xfd, 0xc6,
+	0x03, 0x27, 0x25, 0x00, 0xc0, 0x04, 0x1f, 0x06, 0x0b, 0xd0, 0x06, 0x22, 0x1a, 0x00, 0xca, 0xfe, 0x02, 0xa9, 0x47, 0x27, 0x03, 0x0b, 0xc3, 0x06, 0x15, 0x9d, 0x7a, 0xfe, 0x00, 0x51, 0x00, 0x00,
+	0xc0, 0xa8, 0xa1, 0x0b, 0xfd, 0xc8, 0x03, 0x27, 0xfe, 0x01, 0x75, 0x04, 0x00, 0x7a, 0x00, 0x1a, 0x1f, 0x9d, 0x9a, 0x0b, 0xcf, 0x03, 0x27, 0x28, 0x00, 0xca, 0x26, 0x27, 0x03, 0x0b, 0xc3, 0x03,
+	0x2c, 0xfe, 0x02, 0x27, 0x46, 0x00, 0x08, 0x00, 0x3f, 0xfe, 0x03, 0xcd, 0x0a, 0x0e, 0x06, 0x0b, 0xfd, 0xc5, 0x03, 0x27, 0x2e, 0x00, 0x08, 0x00, 0xfe, 0x01, 0x65, 0x04, 0x27, 0x03, 0x0b, 0xcf,
+	0x03, 0x27, 0x26, 0x00, 0xca, 0xfe, 0x01, 0x95, 0x84, 0x27, 0x03, 0x0b, 0xc2, 0x06, 0x0e, 0x9f, 0x69, 0x3a, 0x9a, 0x7d, 0xc1, 0x37, 0x3b, 0x0e, 0x06, 0x0b, 0xfd, 0xc5, 0x03, 0x27, 0x2e, 0x00,
+	0x7a, 0x00, 0x13, 0x1c, 0xa6, 0x84, 0x06, 0x0b, 0xce, 0x56, 0x27, 0x15, 0x00, 0xca, 0x04, 0x22, 0x06, 0x0b, 0xc2, 0x03, 0x27, 0xfe, 0x02, 0x58, 0x46, 0x00, 0xc2, 0xa2, 0x86, 0x14, 0x1a, 0x06,
+	0x0b, 0xfd, 0xc5, 0x03, 0x27, 0x05, 0x00, 0xc2, 0xfe, 0x02, 0x37, 0xc6, 0x27, 0x03, 0x0b, 0xce, 0x06, 0x22, 0x04, 0x00, 0xca, 0xa7, 0x92, 0x03, 0x0e, 0x06, 0x0b, 0xc1, 0x03, 0x2c, 0x15, 0x00,
+	0x08, 0x00, 0xc1, 0x30, 0xfe, 0x03, 0xee, 0x4b, 0x03, 0x0b, 0xfd, 0xc5, 0x03, 0x27, 0xfe, 0x01, 0x85, 0x44, 0x00, 0xc2, 0xaa, 0xa0, 0x1a, 0x06, 0x0b, 0xcd, 0x06, 0x0e, 0x03, 0x02, 0x00, 0xca,
+	0x08, 0x09, 0x1d, 0x06, 0x0b, 0xc1, 0x06, 0x1a, 0xfe, 0x03, 0x2b, 0x49, 0xfe, 0x00, 0x30, 0xc0, 0x00, 0xc0, 0x08, 0x00, 0xfe, 0x01, 0x65, 0x04, 0x27, 0x03, 0x0b, 0xfd, 0xc5, 0x06, 0x1a, 0xfe,
+	0x00, 0xc2, 0xc2, 0x00, 0xc3, 0xfe, 0x02, 0xfa, 0x88, 0x22, 0x03, 0x0b, 0xcc, 0x06, 0x1d, 0x09, 0x08, 0x00, 0xcb, 0xfe, 0x02, 0xc9, 0x87, 0x27, 0x03, 0x0b, 0xc2, 0x06, 0x22, 0x39, 0x04, 0x00,
+	0xc1, 0xa1, 0x97, 0xfe, 0x03, 0x4b, 0x89, 0x1a, 0x06, 0x6e, 0xfd, 0xc3, 0x06, 0x1f, 0xfe, 0x03, 0x3b, 0x09, 0x00, 0xc2, 0x7a, 0x00, 0xfe, 0x02, 0x17, 0x45, 0x2c, 0x9b, 0xac, 0x0b, 0xcc, 0x03,
+	0x27, 0x30, 0x00, 0xcc, 0xfe, 0x02, 0x07, 0x05, 0x27, 0x03, 0x0b, 0xc3, 0x06, 0x22, 0x1d, 0xfe, 0x02, 0xea, 0x48, 0xfe, 0x01, 0x95, 0x44, 0x08, 0x00, 0xfe, 0x01, 0x54, 0x83, 0x27, 0x03, 0x0b,
+	0xfd, 0xc3, 0x03, 0x27, 0xfe, 0x01, 0xd6, 0x45, 0x00, 0xc4, 0xfe, 0x02, 0xea, 0x08, 0x22, 0x03, 0x0b, 0xcc, 0x03, 0x27, 0xfe, 0x01, 0xf7, 0x05, 0x00, 0xcc, 0xfe, 0x01, 0x34, 0x43, 0x27, 0x03,
+	0x0b, 0xc4, 0x06, 0xc0, 0x22, 0xa4, 0x45, 0x05, 0x00, 0xc0, 0xfe, 0x02, 0xfa, 0x48, 0x22, 0x03, 0x0b, 0xfd, 0xc1, 0x06, 0x0e, 0x3b, 0x32, 0x00, 0xc3, 0x2d, 0x22, 0x06, 0x0b, 0xcd, 0x03, 0x22,
+	0x1e, 0x00, 0xcc, 0x3a, 0x3b, 0xa2, 0x97, 0x06, 0x0b, 0xc5, 0x03, 0xa2, 0x77, 0x11, 0x13, 0x00, 0x29, 0x17, 0x06, 0x0b, 0xfd, 0xc1, 0x03, 0x27, 0xfe, 0x02, 0x37, 0xc6, 0x00, 0xc2, 0xa5, 0x83,
+	0x3e, 0x22, 0x0b, 0xce, 0x06, 0x15, 0x3b, 0x3a, 0x00, 0xcd, 0x2a, 0x22, 0x06, 0x0b, 0xc6, 0x03, 0x2c, 0x07, 0x00, 0xc0, 0x31, 0x2c, 0x03, 0x0b, 0xfd, 0x06, 0x0b, 0x3b, 0xfe, 0x00, 0x61, 0x81,
+	0x00, 0xc0, 0xfe, 0x00, 0xd2, 0xc2, 0x26, 0x2b, 0x27, 0x06, 0x0b, 0xce, 0x06, 0x22, 0x2a, 0x00, 0xce, 0x31, 0x27, 0x03, 0x0b, 0xc6, 0x06, 0x0b, 0x03, 0xfe, 0x00, 0x81, 0xc1, 0x00, 0x1b, 0xfe,
+	0x03, 0x7c, 0x49, 0x1a, 0x06, 0x0b, 0xfc, 0x03, 0xa5, 0x64, 0x07, 0x00, 0xc0, 0xfe, 0x02, 0x68, 0x46, 0x27, 0xc0, 0x1a, 0x03, 0x0b, 0xcf, 0x03, 0x27, 0x2e, 0x00, 0xce, 0xfe, 0x01, 0x44, 0x43,
+	0x27, 0x03, 0x0b, 0xc7, 0x03, 0x27, 0xfe, 0x02, 0xa9, 0x47, 0x00, 0xc0, 0x26, 0x27, 0x03, 0x0b, 0xfb, 0x06, 0x1a, 0x11, 0x18, 0x00, 0xfe, 0x00, 0xe3, 0x02, 0x1f, 0x06, 0x03, 0x06, 0x0b, 0xd0,
+	0x03, 0x27, 0x26, 0x00, 0xce, 0xa4, 0x94, 0xfe, 0x03, 0xac, 0xca, 0x15, 0x06, 0x0b, 0xc7, 0x03, 0x27, 0x26, 0x00, 0xc0, 0xfe, 0x02, 0x88, 0xc7, 0x27, 0x03, 0x0b, 0xfa, 0x03, 0x27, 0xfe, 0x01,
+	0x54, 0x83, 0x00, 0xc0, 0x0a, 0x22, 0x03, 0x0b, 0xd1, 0x06, 0x15, 0x33, 0x23, 0x00, 0xcf, 0xfe, 0x02, 0xda, 0x08, 0x22, 0x03, 0x0b, 0xc7, 0x06, 0x1a, 0x19, 0x20, 0x00, 0x20, 0x14, 0x1a, 0x06,
+	0x0b, 0xf8, 0x03, 0x27, 0x38, 0x00, 0xc0, 0x2e, 0x27, 0x03, 0x0b, 0xd2, 0x03, 0x27, 0x07, 0x00, 0xd0, 0x25, 0x27, 0x03, 0x0b, 0xc8, 0x03, 0x27, 0xfe, 0x02, 0x78, 0x86, 0x00, 0xc0, 0x04, 0x1f,
+	0x06, 0x0b, 0xf7, 0x06, 0x0b, 0x3b, 0x02, 0x00, 0x13, 0x11, 0x1a, 0x06, 0x0b, 0xd2, 0x03, 0x27, 0x25, 0x00, 0xd0, 0xa8, 0x91, 0x06, 0x0b, 0xca, 0x03, 0x27, 0x2e, 0x00, 0xc0, 0xfe, 0x01, 0xf6,
+	0xc5, 0x2c, 0x03, 0x0b, 0xf6, 0x03, 0x2c, 0x10, 0x00, 0xc0, 0xfe, 0x02, 0x27, 0x86, 0x27, 0x03, 0x0b, 0xd4, 0x06, 0x0a, 0x00, 0xd1, 0xfe, 0x02, 0xfa, 0x88, 0x22, 0x03, 0x0b, 0xc8, 0x06, 0xa2,
+	0x67, 0x33, 0x3a, 0x00, 0xc0, 0x38, 0x27, 0x03, 0x0b, 0xf4, 0x03, 0x27, 0x28, 0x00, 0xc0, 0x34, 0x1a, 0x06, 0x0b, 0xd3, 0x03, 0x22, 0xfe, 0x02, 0xfa, 0x88, 0x00, 0xd2, 0x25, 0x27, 0x03, 0x0b,
+	0xc9, 0x03, 0x27, 0x12, 0x00, 0xc0, 0x20, 0xfe, 0x03, 0x5b, 0xc9, 0x1f, 0x03, 0x0b, 0xf2, 0x03, 0x1a, 0x11, 0x20, 0x00, 0xa2, 0x86, 0xfe, 0x03, 0x4b, 0x89, 0x1f, 0x03, 0x0b, 0xd3, 0x03, 0x27,
+	0x25, 0x00, 0xd2, 0x3a, 0xfe, 0x03, 0xcd, 0x0a, 0x0e, 0x0b, 0xca, 0x03, 0x2c, 0xfe, 0x02, 0x27, 0x45, 0x00, 0xc0, 0xfe, 0x00, 0xb2, 0x81, 0xfe, 0x03, 0xbd, 0x4a, 0xa2, 0x87, 0x06, 0x0b, 0xf0,
+	0x06, 0x0b, 0x17, 0x34, 0xfe, 0x00, 0x00, 0x00, 0xc0, 0xfe, 0x02, 0x48, 0x06, 0x27, 0x03, 0x0b, 0xd4, 0x15, 0x3e, 0x3a, 0x00, 0xd3, 0x30, 0x27, 0x03, 0x0b, 0xca, 0x03, 0x27, 0xfe, 0x01, 0x64,
+	0xc3, 0x00, 0xc0, 0xfe, 0x01, 0x24, 0x03, 0xfe, 0x03, 0xed, 0xcb, 0x0b, 0x06, 0x0b, 0xef, 0x03, 0x27, 0x0d, 0x00, 0xc0, 0x2e, 0x27, 0x03, 0x0b, 0xd4, 0x03, 0x27, 0x30, 0x00, 0xd4, 0xfe, 0x01,
+	0x34, 0x43, 0x27, 0x03, 0x0b, 0xca, 0x06, 0x0b, 0x5a, 0xfe, 0x00, 0xd2, 0xc2, 0x00, 0xc0, 0x05, 0x27, 0x06, 0xc0, 0x0b, 0xed, 0x03, 0xa5, 0x64, 0xfe, 0x02, 0x17, 0x45, 0x00, 0xc0, 0xa9, 0x90,
+	0xfe, 0x03, 0xbd, 0x4a, 0xa1, 0x98, 0x06, 0x0b, 0xd4, 0x06, 0x27, 0x23, 0xfe, 0x00, 0x00, 0x00, 0xd4, 0xa1, 0x97, 0xfe, 0x03, 0x6b, 0xc9, 0x1a, 0x06, 0x6e, 0xca, 0x03, 0x1a, 0x9b, 0x7c, 0x3a,
+	0x00, 0xc0, 0xfe, 0x01, 0xb5, 0xc4, 0x27, 0x06, 0xc0, 0x0b, 0xeb, 0x03, 0x2c, 0xfe, 0x02, 0x78, 0x86, 0x00, 0xc0, 0xa3, 0x85, 0x01, 0x22, 0x03, 0x0b, 0xd4, 0x06, 0x1a, 0x98, 0x7e, 0xfe, 0x00,
+	0x10, 0x40, 0x00, 0xd5, 0xfe, 0x01, 0xe6, 0x85, 0x2c, 0x03, 0x0b, 0xcb, 0x03, 0x22, 0xfe, 0x03, 0x3b, 0x89, 0xfe, 0x00, 0x40, 0xc0, 0x00, 0xc0, 0xfe, 0x01, 0xc6, 0x04, 0x27, 0x0b, 0x06, 0x0b,
+	0xe9, 0x03, 0x2c, 0xfe, 0x02, 0xa9, 0x47, 0x00, 0xc1, 0x38, 0x27, 0x03, 0x0b, 0xd5, 0x03, 0x2c, 0x3f, 0x00, 0xd6, 0x32, 0x3b, 0x0e, 0x06, 0x0b, 0xcb, 0x03, 0x27, 0xfe, 0x03, 0x0a, 0x88, 0x13,
+	0x00, 0xc0, 0xfe, 0x01, 0xa5, 0xc4, 0x22, 0x0b, 0x06, 0x0b, 0xe7, 0x03, 0x2c, 0x28, 0xfe, 0x00, 0x10, 0x00, 0x00, 0xc0, 0xfe, 0x02, 0x68, 0x46, 0x2c, 0x9b, 0xac, 0x0b, 0xd5, 0x06, 0x15, 0x9e,
+	0x69, 0xfe, 0x00, 0x61, 0x40, 0x00, 0xd7, 0xfe, 0x02, 0x58, 0x06, 0x27, 0x03, 0x0b, 0xcc, 0x03, 0x27, 0x0f, 0x10, 0x00, 0xc0, 0x36, 0x12, 0x7e, 0x03, 0x0b, 0xe4, 0x06, 0x03, 0x2c, 0xfe, 0x02,
+	0x78, 0x86, 0x00, 0xc1, 0x26, 0x2c, 0x03, 0x0b, 0xd6, 0x03, 0x27, 0xfe, 0x02, 0x48, 0x06, 0x00, 0xd8, 0x0a, 0xfe, 0x03, 0xcd, 0x8a, 0x0b, 0xce, 0x03, 0x27, 0xfe, 0x02, 0xfa, 0x88, 0x18, 0x00,
+	0xc0, 0x04, 0xfe, 0x03, 0x8c, 0x8a, 0x27, 0x03, 0x0b, 0xe2, 0x03, 0x0b, 0x27, 0xfe, 0x02, 0x17, 0x45, 0x00, 0xc1, 0xfe, 0x02, 0x07, 0x05, 0x27, 0x03, 0x0b, 0xd8, 0x03, 0x0a, 0x00, 0xd9, 0x09,
+	0x27, 0x03, 0x0b, 0xcd, 0x03, 0x27, 0xfe, 0x03, 0x1b, 0x08, 0x32, 0x00, 0xc0, 0x02, 0xfe, 0x02, 0xfa, 0x88, 0x2c, 0x06, 0xc0, 0x0b, 0xdf, 0x03, 0x22, 0x08, 0xfe, 0x01, 0x75, 0x44, 0x00, 0xc1,
+	0x26, 0x2c, 0x03, 0x0b, 0xd7, 0x03, 0xa4, 0x75, 0x09, 0x00, 0xda, 0xa8, 0x91, 0x08, 0x0b, 0xcf, 0x03, 0x27, 0x11, 0xfe, 0x00, 0xb2, 0x81, 0x00, 0xc0, 0x7a, 0x26, 0x1f, 0x22, 0x9d, 0x8a, 0x06,
+	0x0b, 0xdb, 0x03, 0x06, 0x2c, 0xfe, 0x03, 0x3b, 0x49, 0x29, 0x00, 0xc1, 0x09, 0x2c, 0x03, 0x0b, 0xd9, 0x08, 0x0a, 0x00, 0xdb, 0xfe, 0x02, 0x58, 0x06, 0x27, 0x03, 0x0b, 0xce, 0x03, 0x22, 0x3b,
+	0xfe, 0x01, 0x44, 0x43, 0x00, 0xc1, 0xfe, 0x01, 0x13, 0xc2, 0xfe, 0x03, 0x4b, 0x89, 0x2c, 0x0e, 0x03, 0x06, 0x0b, 0xd7, 0x06, 0x03, 0x22, 0x56, 0xfe, 0x02, 0x37, 0xc6, 0x10, 0x00, 0xc0, 0xa4,
+	0x94, 0xfe, 0x02, 0xda, 0x48, 0x2c, 0x03, 0x0b, 0xd8, 0x03, 0x27, 0x39, 0x00, 0xdc, 0x3a, 0x3b, 0x0b, 0x06, 0x0b, 0xce, 0x03, 0x15, 0x22, 0xfe, 0x02, 0x17, 0x45, 0x00, 0xc1, 0x10, 0x07, 0x3b,
+	0x27, 0x0e, 0x03, 0x06, 0x0b, 0xd3, 0x03, 0xc0, 0x22, 0x27, 0xfe, 0x03, 0x0a, 0x88, 0x3c, 0x00, 0xc1, 0xfe, 0x00, 0xe3, 0x42, 0x11, 0x27, 0x03, 0x0b, 0xd8, 0x06, 0x12, 0x3b, 0x3a, 0x00, 0xdd,
+	0x3f, 0x2c, 0x03, 0x0b, 0xcf, 0x06, 0xc0, 0x27, 0xfe, 0x02, 0xfa, 0x88, 0xfe, 0x00, 0xb2, 0x41, 0x00, 0xc1, 0x02, 0x36, 0x3b, 0x27, 0x62, 0x06, 0x03, 0x06, 0x0b, 0xcc, 0x06, 0x03, 0xc0, 0x0b,
+	0x22, 0x27, 0xfe, 0x03, 0x2b, 0x49, 0xfe, 0x01, 0x65, 0x03, 0x00, 0xc2, 0xfe, 0x01, 0xd6, 0x85, 0x12, 0x1d, 0x03, 0x0b, 0xd9, 0x03, 0x2c, 0x3f, 0x00, 0xde, 0x10, 0xfe, 0x03, 0x5b, 0xc9, 0xa8,
+	0x92, 0x06, 0x0b, 0xd0, 0x03, 0x22, 0x03, 0xfe, 0x01, 0xd6, 0x45, 0xfe, 0x00, 0x10, 0x40, 0x00, 0xc1, 0x02, 0xfe, 0x02, 0x17, 0x45, 0x11, 0x22, 0x27, 0x1d, 0x06, 0x03, 0xc1, 0x06, 0xc4, 0x03,
+	0xc1, 0x06, 0x0e, 0x22, 0x27, 0x0b, 0xfe, 0x02, 0xda, 0x08, 0xfe, 0x01, 0x44, 0x83, 0x08, 0x00, 0xc1, 0x29, 0xfe, 0x02, 0xfa, 0x88, 0x27, 0x0b, 0x06, 0x0b, 0xd9, 0x06, 0x1a, 0x09, 0x10, 0x00,
+	0xdf, 0x1e, 0x27, 0x03, 0x0b, 0xd1, 0x03, 0x0b, 0x27, 0x36, 0xfe, 0x01, 0x34, 0x43, 0x00, 0xc2, 0x10, 0x23, 0xfe, 0x02, 0x78, 0xc7, 0x11, 0x1a, 0x27, 0xc1, 0x22, 0x1d, 0xc0, 0x1a, 0x1d, 0x22,
+	0xc0, 0x27, 0x2c, 0x22, 0x9c, 0x8b, 0xfe, 0x02, 0xfa, 0x48, 0x3c, 0xfe, 0x00, 0xa2, 0x41, 0x00, 0xc2, 0xa5, 0x93, 0x2e, 0xfe, 0x03, 0xdd, 0x8b, 0x22, 0x03, 0x06, 0x0b, 0xda, 0x03, 0x27, 0x1e,
+	0x00, 0xe1, 0xfe, 0x02, 0x99, 0x07, 0x27, 0x03, 0x0b, 0xd1, 0x06, 0x03, 0x22, 0xc0, 0xfe, 0x02, 0xea, 0x48, 0xfe, 0x01, 0x13, 0xc3, 0x00, 0xc3, 0x10, 0xa9, 0xa1, 0xfe, 0x01, 0x95, 0x84, 0xaa,
+	0x90, 0xa7, 0x92, 0x2a, 0x09, 0x14, 0x19, 0x52, 0x9e, 0x7a, 0x9c, 0x8b, 0x9a, 0x7d, 0x3f, 0xfe, 0x01, 0x24, 0x03, 0x3a, 0x00, 0xc3, 0xa6, 0x83, 0xfe, 0x01, 0xf6, 0xc5, 0xfe, 0x03, 0x9c, 0x8a,
+	0x27, 0x0b, 0x03, 0x0b, 0xdb, 0x03, 0x27, 0x20, 0x00, 0xe2, 0x32, 0xfe, 0x03, 0x9c, 0xca, 0x1a, 0x06, 0x0b, 0xd2, 0x06, 0xc0, 0x22, 0xc0, 0xfe, 0x03, 0x0a, 0xc8, 0x15, 0x32, 0x00, 0xc6, 0x10,
+	0x7a, 0x6e, 0x10, 0x08, 0x00, 0xc6, 0x34, 0x36, 0x30, 0x27, 0x9d, 0xab, 0x03, 0x0b, 0xdc, 0x06, 0x1a, 0x30, 0x32, 0x00, 0xe3, 0xfe, 0x01, 0x64, 0xc3, 0x27, 0x03, 0x0b, 0xd4, 0x03, 0x06, 0x22,
+	0x27, 0x30, 0x20, 0xfe, 0x01, 0x65, 0x03, 0x02, 0x00, 0xcc, 0xa3, 0x95, 0xaa, 0x90, 0xfe, 0x02, 0x07, 0x45, 0x2a, 0x1a, 0x27, 0x15, 0x03, 0x06, 0x0b, 0xdd, 0x03, 0x27, 0x36, 0x00, 0xe5, 0xfe,
+	0x02, 0x88, 0xc7, 0x27, 0x03, 0x0b, 0xd5, 0x06, 0x03, 0x15, 0x27, 0xc0, 0x9b, 0xac, 0x2a, 0x18, 0xfe, 0x01, 0xd6, 0x45, 0x99, 0x7d, 0x3c, 0x24, 0x45, 0x66, 0x7e, 0x34, 0xa4, 0x85, 0xa6, 0xa3,
+	0xa8, 0x92, 0xaa, 0x80, 0xa9, 0xa1, 0x1d, 0x27, 0x22, 0x06, 0x03, 0x06, 0x0b, 0xde, 0x03, 0x27, 0xfe, 0x02, 0x88, 0xc7, 0x00, 0xe6, 0xa3, 0x85, 0x09, 0xa9, 0x81, 0x03, 0x0b, 0xd6, 0x06, 0x03,
+	0xc0, 0x0e, 0x22, 0x27, 0xc1, 0x22, 0x0e, 0x06, 0x03, 0x0b, 0x1d, 0x22, 0x27, 0xc0, 0x22, 0x1a, 0x06, 0x03, 0x06, 0x0b, 0xe0, 0x03, 0x1f, 0x09, 0x18, 0x00, 0xe7, 0x2c, 0xfe, 0x03, 0xdd, 0x8b,
+	0x0b, 0x06, 0x0b, 0xd8, 0x06, 0xc0, 0x03, 0xc1, 0x06, 0x0b, 0xc2, 0x06, 0x03, 0xc2, 0x06, 0x0b, 0xe2, 0x06, 0x0b, 0x12, 0x2c, 0x00, 0xe9, 0xfe, 0x01, 0x95, 0x44, 0x27, 0x03, 0x0b, 0xdf, 0x06,
+	0xc0, 0x0b, 0xe9, 0x03, 0x27, 0x10, 0x00, 0xeb, 0xfe, 0x02, 0x37, 0xc6, 0xfe, 0x03, 0xfe, 0x8b, 0x03, 0x0b, 0xfd, 0xcc, 0x03, 0x2c, 0x2e, 0x00, 0xed, 0xfe, 0x02, 0xb9, 0x87, 0x27, 0x3e, 0x0b,
+	0xfd, 0xca, 0x03, 0x27, 0x38, 0x00, 0xee, 0x13, 0xfe, 0x03, 0x1a, 0xc8, 0x27, 0x03, 0x0b, 0xfd, 0xc8, 0x03, 0x27, 0x22, 0x13, 0x00, 0xef, 0xa4, 0x94, 0x01, 0xaa, 0x90, 0x03, 0x0b, 0xfd, 0xc6,
+	0x03, 0x22, 0x01, 0x23, 0x00, 0xf1, 0x3a, 0x11, 0x22, 0x03, 0x0b, 0xfd, 0xc4, 0x03, 0x22, 0x11, 0x3a, 0x00, 0xf3, 0xa6, 0xa3, 0x09, 0x27, 0x03, 0x0b, 0xfd, 0xc2, 0x03, 0x27, 0x09, 0x02, 0x00,
+	0xf5, 0x3a, 0x39, 0x27, 0x03, 0x0b, 0xfd, 0xc0, 0x3e, 0x27, 0x39, 0x3a, 0x00, 0xf7, 0xa3, 0x95, 0x17, 0x2c, 0x03, 0x06, 0x0b, 0xfa, 0x06, 0x03, 0x2c, 0x17, 0xfe, 0x00, 0x41, 0x00, 0x00, 0xf9,
+	0x08, 0xfe, 0x02, 0x88, 0xc7, 0x2c, 0x06, 0xc0, 0x0b, 0xf8, 0x06, 0xc0, 0x2c, 0x18, 0x08, 0x00, 0xfc, 0x3f, 0x22, 0x1a, 0x03, 0x0b, 0xf6, 0x03, 0x1a, 0x22, 0xfe, 0x01, 0xe6, 0xc5, 0x00, 0xfd,
+	0xc1, 0x1e, 0x28, 0x27, 0x03, 0x06, 0x0b, 0xf2, 0x06, 0x03, 0x27, 0x28, 0x1e, 0x00, 0xfd, 0xc3, 0x3a, 0x38, 0x27, 0x0e, 0x03, 0x0b, 0xf0, 0x03, 0x0e, 0x27, 0xfe, 0x02, 0xc9, 0xc8, 0x3a, 0x00,
+	0xfd, 0xc6, 0xfe, 0x01, 0xa5, 0xc4, 0xfe, 0x03, 0xbd, 0x0a, 0x27, 0x06, 0xc0, 0x0b, 0xec, 0x06, 0x03, 0x27, 0x3b, 0x1d, 0x00, 0xfd, 0xc9, 0x0a, 0xfe, 0x02, 0xa9, 0x47, 0x22, 0xc0, 0x03, 0x06,
+	0x0b, 0xe8, 0x06, 0x03, 0x22, 0xc0, 0xfe, 0x02, 0xa9, 0x87, 0x0a, 0x00, 0xfd, 0xcc, 0xfe, 0x01, 0x34, 0x43, 0xfe, 0x03, 0x2b, 0x49, 0x27, 0x62, 0x03, 0x06, 0x0b, 0xe4, 0x06, 0x03, 0x1d, 0x27,
+	0x36, 0x23, 0x00, 0xfd, 0xcf, 0x7a, 0xfe, 0x01, 0x95, 0x84, 0x01, 0x27, 0x22, 0x06, 0x5a, 0x06, 0x0b, 0xde, 0x06, 0x03, 0x06, 0x22, 0x27, 0x09, 0x15, 0x08, 0x00, 0xfd, 0xd2, 0xa2, 0x86, 0xfe,
+	0x01, 0x85, 0x44, 0xfe, 0x03, 0x1b, 0x08, 0x22, 0x6e, 0x0e, 0x03, 0xc0, 0x06, 0x0b, 0xd8, 0x06, 0x03, 0xc0, 0x0e, 0x27, 0x22, 0x2a, 0x0d, 0x10, 0x00, 0xfd, 0xd7, 0xfe, 0x01, 0x24, 0x03, 0xfe,
+	0x02, 0x99, 0x07, 0xfe, 0x03, 0xad, 0x0a, 0x27, 0x22, 0x0e, 0x03, 0xc0, 0x06, 0xc0, 0x0b, 0xd0, 0x06, 0xc0, 0x03, 0xc0, 0x0e, 0x22, 0x27, 0x38, 0xfe, 0x02, 0x99, 0x47, 0x1b, 0x00, 0xfd, 0xdc,
+	0x3a, 0x15, 0xfe, 0x02, 0xca, 0x08, 0x33, 0x27, 0xc0, 0x22, 0x0e, 0x06, 0x03, 0xc2, 0x06, 0xc6, 0x03, 0xc2, 0x06, 0x0e, 0x22, 0x27, 0xc0, 0x3b, 0x07, 0x15, 0x3a, 0x00, 0xfd, 0xe1, 0x3a, 0xfe,
+	0x01, 0x54, 0x83, 0xfe, 0x02, 0x58, 0x06, 0x2a, 0xa7, 0xa3, 0x22, 0x27, 0xc1, 0x22, 0x1d, 0xc0, 0x1a, 0x66, 0xc0, 0x1a, 0x1d, 0xc0, 0x22, 0x27, 0xc1, 0x22, 0x36, 0x2a, 0x39, 0xfe, 0x01, 0x54,
+	0xc3, 0x3a, 0x00, 0xfd, 0xe8, 0x32, 0x3c, 0xa9, 0x91, 0xa8, 0x92, 0x28, 0xa5, 0x94, 0xa3, 0x96, 0xa3, 0x85, 0x2b, 0xc2, 0x14, 0x3c, 0x1a, 0x28, 0x26, 0x15, 0x97, 0x7f, 0x32, 0x00, 0xfd, 0xf3,
+	0x10, 0x7e, 0x7a, 0xc0, 0x18, 0x10, 0x00, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xd5,
+};
+
+const struct IMG_Image smiley_asset = {
+		.name = "smiley",
+		.data = (const uint8_t*)smiley_data,
+		.size = sizeof(smiley_data),
+		.width = 128,
+		.height = 160,
+		.encoding = IMG_ENCODING_QOI,
+		.format = PIXEL_FORMAT_666,
+};
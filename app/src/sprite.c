@@ -0,0 +1,255 @@
+/*
+ * sprite.c
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <string.h>
+#include "sprite.h"
+
+static uint32_t SPR_IsDrawable(const struct IMG_Image* image, const enum PIXEL_FORMAT format) {
+	// Rows are read at random : only raw images, in the controller format
+	return image != 0 && image->encoding == IMG_ENCODING_RAW && image->format == format;
+}
+
+static uint32_t SPR_BytesPerPixel(const enum PIXEL_FORMAT format) {
+	// Whole bytes only, 4-4-4 pixels are copied one by one
+	if (format == PIXEL_FORMAT_666) return 3;
+	if (format == PIXEL_FORMAT_565) return 2;
+	return 0;
+}
+
+static uint32_t SPR_SameSprite(const struct SPR_Sprite* a, const struct SPR_Sprite* b) {
+	return a->image == b->image && a->x == b->x && a->y == b->y &&
+			a->key == b->key && a->keyed == b->keyed && a->visible == b->visible;
+}
+
+static uint32_t SPR_SpriteRegion(const struct SPR_Sprite* sprite, struct SPR_Region* region) {
+	// Visible part of the sprite, returns 0 when there is none
+	if (!sprite->visible || sprite->image == 0) return 0;
+
+	const int32_t x_start = (sprite->x < 0) ? 0 : sprite->x;
+	const int32_t y_start = (sprite->y < 0) ? 0 : sprite->y;
+	int32_t x_end = sprite->x + sprite->image->width - 1;
+	int32_t y_end = sprite->y + sprite->image->height - 1;
+
+	if (x_end > ST7735_GetWidth() - 1) x_end = ST7735_GetWidth() - 1;
+	if (y_end > ST7735_GetHeight() - 1) y_end = ST7735_GetHeight() - 1;
+	if (x_end < x_start || y_end < y_start) return 0;
+
+	region->x_start = x_start;
+	region->y_start = y_start;
+	region->x_end = x_end;
+	region->y_end = y_end;
+
+	return 1;
+}
+
+static uint32_t SPR_RegionArea(const struct SPR_Region* region) {
+	return (region->x_end - region->x_start + 1) * (region->y_end - region->y_start + 1);
+}
+
+static struct SPR_Region SPR_RegionUnion(const struct SPR_Region* a, const struct SPR_Region* b) {
+	const struct SPR_Region region = {
+			.layer = a->layer,
+			.x_start = (a->x_start < b->x_start) ? a->x_start : b->x_start,
+			.y_start = (a->y_start < b->y_start) ? a->y_start : b->y_start,
+			.x_end = (a->x_end > b->x_end) ? a->x_end : b->x_end,
+			.y_end = (a->y_end > b->y_end) ? a->y_end : b->y_end,
+	};
+	return region;
+}
+
+static uint32_t SPR_RegionsTouch(const struct SPR_Region* a, const struct SPR_Region* b) {
+	// Overlapping or adjacent : the union doesn't send any pixel twice
+	return a->x_start <= b->x_end + 1 && b->x_start <= a->x_end + 1 &&
+			a->y_start <= b->y_end + 1 && b->y_start <= a->y_end + 1;
+}
+
+static void SPR_AddRegion(struct SPR_Layer* layer, struct SPR_Region region) {
+	region.layer = layer;
+
+	// Merged with the regions it touches, as long as the union keeps growing
+	uint32_t merged = 1;
+
+	while (merged) {
+		merged = 0;
+
+		for (uint32_t i = 0; i < layer->region_count; ++i) {
+			if (!SPR_RegionsTouch(&layer->regions[i], &region)) continue;
+
+			region = SPR_RegionUnion(&layer->regions[i], &region);
+			layer->regions[i] = layer->regions[--layer->region_count];
+			merged = 1;
+			break;
+		}
+	}
+
+	if (layer->region_count == SPR_REGION_MAX) {
+		// No room left : merge with the region that grows the least
+		uint32_t best = 0;
+		uint32_t best_growth = UINT32_MAX;
+
+		for (uint32_t i = 0; i < layer->region_count; ++i) {
+			const struct SPR_Region bounds = SPR_RegionUnion(&layer->regions[i], &region);
+			const uint32_t growth = SPR_RegionArea(&bounds) - SPR_RegionArea(&layer->regions[i]);
+
+			if (growth < best_growth) {
+				best = i;
+				best_growth = growth;
+			}
+		}
+
+		region = SPR_RegionUnion(&layer->regions[best], &region);
+		layer->regions[best] = layer->regions[--layer->region_count];
+
+		// The union may now touch other regions
+		SPR_AddRegion(layer, region);
+		return;
+	}
+
+	layer->regions[layer->region_count++] = region;
+}
+
+static void SPR_RenderBackground(const struct SPR_Layer* layer, uint8_t* band, const uint32_t first,
+		const struct SPR_Region* region, const uint32_t y, const enum PIXEL_FORMAT format) {
+	// One line of the region : background image where it covers it, background color elsewhere
+	const struct IMG_Image* background = layer->background;
+	const uint32_t width = region->x_end - region->x_start + 1;
+	uint32_t covered = 0;
+
+	if (SPR_IsDrawable(background, format) && y < background->height && region->x_start < background->width) {
+		covered = background->width - region->x_start;
+		if (covered > width) covered = width;
+
+		const uint32_t source = y * background->width + region->x_start;
+		const uint32_t bytes = SPR_BytesPerPixel(format);
+
+		if (bytes != 0) {
+			memcpy(band + first * bytes, background->data + source * bytes, covered * bytes);
+		}
+		else {
+			for (uint32_t x = 0; x < covered; ++x) {
+				IMG_StorePixel(band, first + x, IMG_LoadPixel(background->data, source + x, format), format);
+			}
+		}
+	}
+
+	for (uint32_t x = covered; x < width; ++x) IMG_StorePixel(band, first + x, layer->background_color, format);
+}
+
+static void SPR_RenderSprite(const struct SPR_Sprite* sprite, uint8_t* band, const uint32_t first,
+		const struct SPR_Region* region, const uint32_t y, const enum PIXEL_FORMAT format) {
+	// Part of one sprite row that falls on one line of the region, key colored pixels are skipped
+	const struct IMG_Image* image = sprite->image;
+
+	if (!sprite->visible || !SPR_IsDrawable(image, format)) return;
+
+	const int32_t row = (int32_t)y - sprite->y;
+	if (row < 0 || row >= image->height) return;
+
+	int32_t x_start = sprite->x;
+	int32_t x_end = sprite->x + image->width - 1;
+	if (x_start < region->x_start) x_start = region->x_start;
+	if (x_end > region->x_end) x_end = region->x_end;
+	if (x_end < x_start) return;
+
+	const uint32_t source = row * image->width + (x_start - sprite->x);
+	const uint32_t target = first + (x_start - region->x_start);
+	const uint32_t count = x_end - x_start + 1;
+	const uint32_t bytes = SPR_BytesPerPixel(format);
+
+	if (!sprite->keyed && bytes != 0) {
+		memcpy(band + target * bytes, image->data + source * bytes, count * bytes);
+		return;
+	}
+
+	for (uint32_t x = 0; x < count; ++x) {
+		const uint32_t color = IMG_LoadPixel(image->data, source + x, format);
+
+		if (sprite->keyed && color == sprite->key) continue;
+
+		IMG_StorePixel(band, target + x, color, format);
+	}
+}
+
+static void SPR_RenderBand(void* context, uint8_t* band, const uint16_t first_line, const uint16_t lines) {
+	// Band renderer, called from the DMA1 Channel 3 ISR : background, then the sprites in list order
+	const struct SPR_Region* region = (const struct SPR_Region*)context;
+	const struct SPR_Layer* layer = region->layer;
+	const enum PIXEL_FORMAT format = ST7735_GetPixelFormat();
+	const uint32_t width = region->x_end - region->x_start + 1;
+
+	for (uint32_t line = 0; line < lines; ++line) {
+		const uint32_t y = region->y_start + first_line + line;
+		const uint32_t first = line * width;
+
+		SPR_RenderBackground(layer, band, first, region, y, format);
+
+		for (uint32_t i = 0; i < layer->shown_count; ++i) {
+			SPR_RenderSprite(&layer->shown[i], band, first, region, y, format);
+		}
+	}
+}
+
+void SPR_Init(struct SPR_Layer* layer, const struct IMG_Image* background, const uint32_t background_color,
+		const struct SPR_Sprite* sprites, const uint32_t count, uint8_t* buffer, const uint16_t band_lines) {
+	// The whole display is sent by the first present
+	layer->background = background;
+	layer->background_color = background_color;
+	layer->sprites = sprites;
+	layer->count = (count > SPR_MAX) ? SPR_MAX : count;
+	layer->buffer = buffer;
+	layer->band_lines = band_lines;
+
+	layer->shown_count = 0;
+	layer->region_count = 0;
+	layer->handle = 0;
+	layer->full = 1;
+}
+
+void SPR_Invalidate(struct SPR_Layer* layer) {
+	// Background changed, or the display was drawn over
+	layer->full = 1;
+}
+
+ST7735_Handle SPR_Present(struct SPR_Layer* layer) {
+	// Re-sends the areas covered by the sprites that changed since the last present, before and after the change
+	// Waits for the previous present : the band renderer reads its snapshot and regions
+	ST7735_Wait(layer->handle);
+
+	layer->region_count = 0;
+
+	if (layer->full) {
+		const struct SPR_Region screen = { layer, 0, 0, ST7735_GetWidth() - 1, ST7735_GetHeight() - 1 };
+
+		SPR_AddRegion(layer, screen);
+		layer->full = 0;
+	}
+	else {
+		const uint32_t count = (layer->count > layer->shown_count) ? layer->count : layer->shown_count;
+
+		for (uint32_t i = 0; i < count; ++i) {
+			const struct SPR_Sprite* before = (i < layer->shown_count) ? &layer->shown[i] : 0;
+			const struct SPR_Sprite* after = (i < layer->count) ? &layer->sprites[i] : 0;
+			struct SPR_Region region;
+
+			if (before != 0 && after != 0 && SPR_SameSprite(before, after)) continue;
+
+			if (before != 0 && SPR_SpriteRegion(before, &region)) SPR_AddRegion(layer, region);
+			if (after != 0 && SPR_SpriteRegion(after, &region)) SPR_AddRegion(layer, region);
+		}
+	}
+
+	memcpy(layer->shown, layer->sprites, layer->count * sizeof(struct SPR_Sprite));
+	layer->shown_count = layer->count;
+
+	for (uint32_t i = 0; i < layer->region_count; ++i) {
+		const struct SPR_Region* region = &layer->regions[i];
+
+		layer->handle = ST7735_RenderBandsDMA(region->x_start, region->y_start, region->x_end, region->y_end,
+				layer->band_lines, layer->buffer, SPR_RenderBand, &layer->regions[i]);
+	}
+
+	return layer->handle;
+}
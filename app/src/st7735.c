@@ -10,7 +10,111 @@
 
 __IO uint8_t flag__dma1_channel3_done = 1;
 
-void ST7735_Init(void) {
+// Pixel format currently programmed in COLMOD
+static enum PIXEL_FORMAT pixel_format = PIXEL_FORMAT_666;
+
+// SPI1 baud rate prescalers (BR field) for writes (RAMWR, commands) and reads
+// Reads stay at /256 by default : the dummy clock handling in ST7735_ReadBytes is tuned for 250kHz
+static uint8_t spi_br_write = 0x07;
+static uint8_t spi_br_read = 0x07;
+
+// Shadow of the controller registers, unchanged values are not sent again and nothing is read back
+// outside of ST7735_Resync. COLMOD is 0 when unknown, the window is only valid once CASET / RASET were sent
+static uint8_t shadow_madctl = 0x00;
+static uint8_t shadow_colmod = 0x00;
+static uint8_t shadow_column_valid = 0;
+static uint8_t shadow_row_valid = 0;
+static uint8_t shadow_xs = 0;
+static uint8_t shadow_xe = 0;
+static uint8_t shadow_ys = 0;
+static uint8_t shadow_ye = 0;
+
+// Orientation and logical geometry, MADCTL MV / MX / MY for 0, 90, 180 and 270 degrees
+static const uint8_t orientation_madctl[] = {
+		0x00, MADCTL_MV | MADCTL_MX, MADCTL_MX | MADCTL_MY, MADCTL_MV | MADCTL_MY
+};
+static enum ORIENTATION orientation = ORIENTATION_0;
+static uint8_t mirror_x = 0;
+static uint8_t mirror_y = 0;
+static uint8_t display_width = DISPLAY_WIDTH;
+static uint8_t display_height = DISPLAY_HEIGHT;
+
+static void ST7735_UpdateMADCTL(void);
+static uint8_t ST7735_ClipSize(const uint8_t start, const uint32_t size, const uint8_t limit);
+static ST7735_Handle ST7735_SubmitRegion(const void* buffer, const uint32_t stride, const uint8_t src_x, const uint8_t src_y,
+		const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start, const uint8_t flags);
+
+static void ST7735_SetDataSize16(void);
+static void ST7735_SetDataSize8(void);
+static void ST7735_SetPrescaler(const uint8_t br);
+static uint8_t ST7735_RegionAligned(const uint8_t src_x, const uint8_t width, const uint8_t height);
+static void ST7735_BeginData(const uint8_t with_window, const uint8_t xs, const uint8_t xe, const uint8_t ys, const uint8_t ye,
+		const uint8_t command);
+
+// Panel initialization, run in a single CS burst by ST7735_Init
+static const uint8_t init_list[] = {
+		// Software reset, must wait at least 120ms
+		SWRESET, ST7735_CMD_DELAY | 0, 130,
+		// Sleep out, must wait at least 120ms
+		SLPOUT, ST7735_CMD_DELAY | 0, 130,
+		// Column and row address sets to full screen
+		CASET, 4, 0, 0, 0, DISPLAY_WIDTH-1,
+		RASET, 4, 0, 0, 0, DISPLAY_HEIGHT-1,
+		// Display ON
+		DISPON, 0,
+		ST7735_CMD_END
+};
+
+// Ring of pending DMA transactions, the head one is on the bus while queue_running is set
+static struct ST7735_Transaction queue[ST7735_QUEUE_SIZE];
+static volatile uint32_t queue_head = 0;
+static volatile uint32_t queue_tail = 0;
+static volatile uint32_t queue_count = 0;
+static volatile uint8_t queue_running = 0;
+static ST7735_Handle queue_last_handle = 0;
+static volatile ST7735_Handle queue_done_handle = 0;
+
+// Progress of the head transaction when it's made of several rows
+static uint32_t queue_row = 0;
+static uint32_t queue_row_address = 0;
+
+// Line pattern streamed by fill transactions (rebuilt when a fill starts, word aligned for 16 bit DMA)
+static uint32_t fill_pattern[(ST7735_FILL_PATTERN_PIXELS * 3 + 3) / 4];
+
+// Band transactions : next band to render, two bands in the current DMA run, first buffer refilled during the run
+static uint32_t band_next = 0;
+static uint8_t band_pair = 0;
+static uint8_t band_refilled = 0;
+
+// Tearing effect synchronization : enabled, head transaction waiting for the next TE edge
+static uint8_t te_enabled = 0;
+static volatile uint8_t te_waiting = 0;
+static volatile uint32_t te_last_edge = 0;
+static volatile uint32_t te_period = 0;
+
+// Presentation timestamps (DWT cycle counter) of the last synchronized transactions
+static volatile uint32_t present_timestamps[ST7735_PRESENT_HISTORY];
+static volatile uint32_t present_count = 0;
+
+// Vertical scrolling : top fixed area, scroll area height, current scroll start address
+static uint8_t scroll_top = 0;
+static uint8_t scroll_height = ST7735_SCROLL_HEIGHT;
+static uint8_t scroll_start = 0;
+
+// Power profile, also switched back to normal from the DMA ISR
+static volatile enum POWER_PROFILE power_profile = POWER_NORMAL;
+static uint8_t partial_start = 0;
+static uint8_t partial_end = DISPLAY_HEIGHT-1;
+
+static void ST7735_ExitLowPower(const uint8_t flags);
+static void ST7735_StartTransaction(void);
+static void ST7735_LaunchTransaction(void);
+static uint32_t ST7735_RowCount(const struct ST7735_Transaction* transaction, const uint32_t row);
+static uint32_t ST7735_StartBands(const struct ST7735_Transaction* transaction);
+static void ST7735_BandHalfTransfer(const struct ST7735_Transaction* transaction);
+static uint32_t ST7735_BandTransferComplete(const struct ST7735_Transaction* transaction);
+
+void ST7735_Init(const enum PIXEL_FORMAT format) {
 
 	// Using SPI1, 8 bits / bi-directionnal interface
 	//
@@ -27,13 +131,17 @@ void ST7735_Init(void) {
 	//    - PA11 : BLK (back light control)
 	//
 	// F(PCLK) = F(PCLK2) = 64MHz
-	// (Debug/Troubleshooting purposes) Baud rate is 250kHz => BR = /256
+	// Baud rate is 250kHz => BR = /256 during initialization,
+	// use ST7735_SetSPIClock afterwards to select faster write / read clocks
 	//
-	// Default pixel color format : 18bits / pixel (6/6/6)
+	// Pixel color format is given by the caller and written to COLMOD:
+	//    - 18bits / pixel (6/6/6) : 3 bytes per pixel, 8 bit SPI frames
+	//    - 16bits / pixel (5/6/5) : 1 half-word per pixel, 16 bit SPI frames for RAMWR payloads
+	//    - 12bits / pixel (4/4/4) : 2 pixels packed in 3 bytes, 8 bit SPI frames
 	//
 	// Using DMA1 Channel 3 (SPI_TX) to unload CPU for frame transmission
 	// Memory to peripheral => frame_buffer to SPI1->DR
-	// Memory size and peripheral size are 8 bits (default)
+	// Memory size and peripheral size are 8 bits (default), 16 bits for 5/6/5 payloads
 	// Memory increment enabled, peripheral increment disabled
 	// Circular mode disabled (since frame_buffer is constant / not updated)
 
@@ -113,8 +221,10 @@ void ST7735_Init(void) {
 	// Enable software slave management
 	SPI1->CR1 |= SPI_CR1_SSM | SPI_CR1_SSI;
 
-	// Set Baud rate to 250kHz
+	// Set Baud rate to 250kHz, until ST7735_SetSPIClock is called again
 	SPI1->CR1 |= (0x07 << SPI_CR1_BR_Pos);
+	spi_br_write = 0x07;
+	spi_br_read = 0x07;
 
 	// Set SPI1 FIFO RX threshold to 8 bit
 	SPI1->CR2 |= SPI_CR2_FRXTH;
@@ -132,24 +242,30 @@ void ST7735_Init(void) {
 	ST7735_HWReset();
 	TIM_Delay_Milli(130);
 
-	// Software reset
-	ST7735_SendCommand(SWRESET);
-
-	// Must wait at least 120ms after SW reset
-	TIM_Delay_Milli(130);
-
-	// Sleep out
-	ST7735_SendCommand(SLPOUT);
-
-	// Must wait at least 120ms after SLPOUT
-	TIM_Delay_Milli(130);
-
-	// Set column and row address sets to full screen
-	ST7735_SetColumnAddress(0, DISPLAY_WIDTH-1);
-	ST7735_SetRowAddress(0, DISPLAY_HEIGHT-1);
-
-	// Display ON
-	ST7735_SendCommand(DISPON);
+	// Register setup : software reset, sleep out, full screen window, display ON
+	ST7735_RunCommandList(init_list);
+
+	// Registers are back to their reset values, except for the window set by the init list
+	orientation = ORIENTATION_0;
+	mirror_x = 0;
+	mirror_y = 0;
+	display_width = DISPLAY_WIDTH;
+	display_height = DISPLAY_HEIGHT;
+	shadow_madctl = 0x00;
+	shadow_colmod = 0x00;
+	shadow_column_valid = 1;
+	shadow_row_valid = 1;
+	shadow_xs = 0;
+	shadow_xe = DISPLAY_WIDTH-1;
+	shadow_ys = 0;
+	shadow_ye = DISPLAY_HEIGHT-1;
+	scroll_top = 0;
+	scroll_height = ST7735_SCROLL_HEIGHT;
+	scroll_start = 0;
+	power_profile = POWER_NORMAL;
+
+	// Interface pixel format (depends on the format requested at runtime)
+	ST7735_SetPixelFormat(format);
 }
 
 void ST7735_NVIC_Init(void) {
@@ -158,7 +274,7 @@ void ST7735_NVIC_Init(void) {
 	NVIC_EnableIRQ(DMA1_Channel3_IRQn);
 }
 
-uint32_t ST7735_ConfigDMA(const uint32_t mem_address, const uint32_t byte_count)
+uint32_t ST7735_ConfigDMA(const uint32_t mem_address, const uint32_t data_count, const uint32_t half_word)
 {
 	if(flag__dma1_channel3_done == 0) return 0;
 
@@ -171,12 +287,325 @@ uint32_t ST7735_ConfigDMA(const uint32_t mem_address, const uint32_t byte_count)
 	// Set memory address
 	DMA1_Channel3->CMAR = mem_address;
 
-	// Set number of data to transfer
-	DMA1_Channel3->CNDTR = byte_count;
+	// Set number of data to transfer (bytes or half-words)
+	DMA1_Channel3->CNDTR = data_count;
+
+	// Memory and peripheral sizes : 8 bits or 16 bits
+	DMA1_Channel3->CCR &= ~(DMA_CCR_MSIZE_Msk | DMA_CCR_PSIZE_Msk);
+	if (half_word) DMA1_Channel3->CCR |= (0x01 << DMA_CCR_MSIZE_Pos) | (0x01 << DMA_CCR_PSIZE_Pos);
+
+	return 1;
+}
+
+uint32_t ST7735_SetSPIClock(const uint32_t write_max_hz, const uint32_t read_max_hz) {
+	// SCK = PCLK2 / 2^(BR+1), pick the fastest clock that doesn't exceed the requested maximum
+	const uint32_t pclk2 = SystemCoreClock >> APBPrescTable[(RCC->CFGR & RCC_CFGR_PPRE2) >> RCC_CFGR_PPRE2_Pos];
+
+	uint8_t br_write = 0;
+	while (br_write < 0x07 && (pclk2 >> (br_write + 1)) > write_max_hz) ++br_write;
+
+	uint8_t br_read = 0;
+	while (br_read < 0x07 && (pclk2 >> (br_read + 1)) > read_max_hz) ++br_read;
+
+	// Don't change the clock in the middle of a DMA transfer
+	ST7735_WaitIdle();
+
+	spi_br_write = br_write;
+	spi_br_read = br_read;
+
+	ST7735_SetPrescaler(spi_br_write);
+
+	return pclk2 >> (spi_br_write + 1);
+}
+
+static void ST7735_SetPrescaler(const uint8_t br) {
+	if (((SPI1->CR1 & SPI_CR1_BR_Msk) >> SPI_CR1_BR_Pos) == br) return;
+
+	// wait while SPI is busy
+	while((SPI1->SR & SPI_SR_BSY) != 0);
+
+	// BR can only be changed while SPI is disabled
+	SPI1->CR1 &= ~SPI_CR1_SPE;
+
+	SPI1->CR1 &= ~SPI_CR1_BR_Msk;
+	SPI1->CR1 |= (br << SPI_CR1_BR_Pos);
+
+	SPI1->CR1 |= SPI_CR1_SPE;
+}
+
+void ST7735_SetPixelFormat(const enum PIXEL_FORMAT format) {
+	const uint8_t colmod = (uint8_t)format;
+
+	// Already programmed
+	if (colmod == shadow_colmod) return;
+
+	// Queued transactions were sized for the previous format
+	ST7735_WaitIdle();
+
+	ST7735_WriteBytes(COLMOD, &colmod, 1);
+
+	shadow_colmod = colmod;
+	pixel_format = format;
+}
+
+enum PIXEL_FORMAT ST7735_GetPixelFormat(void) {
+	return pixel_format;
+}
+
+uint32_t ST7735_GetFrameSize(const uint32_t pixel_count) {
+	// Number of bytes sent after RAMWR for pixel_count pixels
+	switch (pixel_format) {
+	case PIXEL_FORMAT_444:
+		// 2 pixels in 3 bytes, last odd pixel takes 2 bytes
+		return (pixel_count * 3 + 1) / 2;
+	case PIXEL_FORMAT_565:
+		return pixel_count * 2;
+	case PIXEL_FORMAT_666:
+	default:
+		return pixel_count * 3;
+	}
+}
+
+void ST7735_Pack444(uint8_t* packed, const uint16_t* pixels, const uint32_t pixel_count) {
+	// Pixels are 0x0RGB, each pair (P0, P1) becomes R0G0 B0R1 G1B1
+	uint32_t i = 0;
+
+	for (; i + 1 < pixel_count; i += 2) {
+		const uint16_t p0 = *(pixels + i);
+		const uint16_t p1 = *(pixels + i + 1);
+
+		*(packed++) = (uint8_t)(p0 >> 4);
+		*(packed++) = (uint8_t)(((p0 & 0x00F) << 4) | (p1 >> 8));
+		*(packed++) = (uint8_t)p1;
+	}
+
+	// Odd pixel count : last pixel is R0G0 B0(pad)
+	if (i < pixel_count) {
+		const uint16_t p0 = *(pixels + i);
+
+		*(packed++) = (uint8_t)(p0 >> 4);
+		*(packed) = (uint8_t)((p0 & 0x00F) << 4);
+	}
+}
+
+static void ST7735_SetDataSize16(void) {
+	// wait while SPI is busy, DS must not change during a transfer
+	while((SPI1->SR & SPI_SR_BSY) != 0);
+
+	// 0x07 => 0x0F
+	// NOTE: Make sure to write to SPI DS the right way because if the register is cleared (=0x0) it is automatically set back to 0x07
+	SPI1->CR2 |= (0x08 << SPI_CR2_DS_Pos);
+}
+
+static void ST7735_SetDataSize8(void) {
+	// wait while SPI is busy, DS must not change during a transfer
+	while((SPI1->SR & SPI_SR_BSY) != 0);
+
+	// 0x0F => 0x07
+	SPI1->CR2 &= ~(0x08 << SPI_CR2_DS_Pos);
+}
+
+static void ST7735_TransmitBytes(const uint8_t* bytes, const uint32_t n) {
+	// Polled 8 bit frames, CS / DC must already be set
+	// Data packing : a 16 bit access to DR pushes 2 frames in the TX FIFO (first byte in the LSB),
+	// TXE means at least half of the 32 bit FIFO is free
+	uint32_t i = 0;
+
+	// 4 bytes per iteration
+	for (; i + 4 <= n; i += 4) {
+		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint16_t*)&SPI1->DR = (uint16_t)(*(bytes + i) | (*(bytes + i + 1) << 8));
+
+		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint16_t*)&SPI1->DR = (uint16_t)(*(bytes + i + 2) | (*(bytes + i + 3) << 8));
+	}
+
+	if (i + 2 <= n) {
+		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint16_t*)&SPI1->DR = (uint16_t)(*(bytes + i) | (*(bytes + i + 1) << 8));
+		i += 2;
+	}
+
+	// Odd tail
+	if (i < n) {
+		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint8_t*)&SPI1->DR = *(bytes + i);
+	}
+}
+
+static void ST7735_StreamPixels(const void* pixels, const uint32_t pixel_count) {
+	// RAMWR must have been sent already, with DC high and CS low
+
+	if (pixel_format != PIXEL_FORMAT_565) {
+		ST7735_TransmitBytes((const uint8_t*)pixels, ST7735_GetFrameSize(pixel_count));
+		return;
+	}
+
+	const uint16_t* half_words = (const uint16_t*)pixels;
+
+	// One 16 bit SPI frame per pixel, MSB (red) first
+	ST7735_SetDataSize16();
+
+	for (uint32_t i = 0; i < pixel_count; ++i) {
+
+		// wait for TX buffer to empty
+		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+
+		// write pixel
+		SPI1->DR = *(half_words + i);
+	}
+
+	// Back to 8 bit frames (waits for BSY)
+	ST7735_SetDataSize8();
+}
+
+static void ST7735_WritePixels(const uint8_t* pixels, const uint32_t stride, const uint32_t row_size, const uint32_t rows) {
+	// rows of row_size pixels, stride bytes apart in the source buffer
+	// ST7735_BeginData must have been called (window + RAMWR)
+
+	for (uint32_t row = 0; row < rows; ++row) {
+		ST7735_StreamPixels(pixels + row * stride, row_size);
+	}
+
+	// wait while SPI is busy
+	while((SPI1->SR & SPI_SR_BSY) != 0);
+
+	// Set CS high
+	GPIOA->ODR |= GPIO_ODR_OD4;
+}
+
+/////////////////////////////////////////////// Command lists
+static uint32_t ST7735_SendArgsDMA(const uint8_t* args, const uint32_t n) {
+	// Long argument runs : DMA with polling on the transfer complete flag (bus is idle, the ISR must not run)
+	// Returns 0 (nothing sent) if the channel is still busy
+	if (!ST7735_ConfigDMA((uint32_t)args, n, 0)) return 0;
+
+	DMA1_Channel3->CCR &= ~(DMA_CCR_TCIE | DMA_CCR_HTIE);
+
+	DMA1_Channel3->CCR |= DMA_CCR_EN;
+	SPI1->CR2 |= SPI_CR2_TXDMAEN;
+
+	while((DMA1->ISR & DMA_ISR_TCIF3) != DMA_ISR_TCIF3);
+	DMA1->IFCR |= DMA_IFCR_CGIF3;
+
+	// wait while SPI is busy
+	while((SPI1->SR & SPI_SR_BSY) != 0);
+
+	SPI1->CR2 &= ~SPI_CR2_TXDMAEN;
+	DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+	DMA1_Channel3->CCR |= DMA_CCR_TCIE;
 
 	return 1;
 }
 
+static void ST7735_StreamCommandList(const uint8_t* list) {
+	// CS must be low, it stays low except during delays
+	// DC only changes between a command and its arguments
+
+	// Transmit only mode
+	SPI1->CR1 |= SPI_CR1_BIDIOE;
+
+	while (*list != ST7735_CMD_END) {
+		const uint8_t command = *(list++);
+		const uint8_t argc = *(list) & ~ST7735_CMD_DELAY;
+		const uint8_t delay = *(list++) & ST7735_CMD_DELAY;
+
+		// DC can only change once the previous byte is out
+		while((SPI1->SR & SPI_SR_BSY) != 0);
+
+		// Command => DC Low
+		GPIOA->ODR &= ~GPIO_ODR_OD9;
+
+		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint8_t*)&SPI1->DR = command;
+
+		if (argc != 0) {
+			while((SPI1->SR & SPI_SR_BSY) != 0);
+
+			// Data => DC High
+			GPIOA->ODR |= GPIO_ODR_OD9;
+
+			// Polled bytes for short runs, or if the DMA channel is busy
+			if (argc < ST7735_CMD_DMA_MIN || !ST7735_SendArgsDMA(list, argc)) {
+				ST7735_TransmitBytes(list, argc);
+			}
+
+			list += argc;
+		}
+
+		if (delay) {
+			while((SPI1->SR & SPI_SR_BSY) != 0);
+
+			GPIOA->ODR |= GPIO_ODR_OD4;
+			TIM_Delay_Milli(*(list++));
+			GPIOA->ODR &= ~GPIO_ODR_OD4;
+		}
+	}
+
+	// wait while SPI is busy
+	while((SPI1->SR & SPI_SR_BSY) != 0);
+}
+
+void ST7735_RunCommandList(const uint8_t* list) {
+	// list : { command, [ST7735_CMD_DELAY |] argument count, arguments..., [delay in ms] }, ..., ST7735_CMD_END
+	// Can be kept in flash
+
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
+	// Set CS low
+	GPIOA->ODR &= ~GPIO_ODR_OD4;
+
+	ST7735_StreamCommandList(list);
+
+	// Set CS high
+	GPIOA->ODR |= GPIO_ODR_OD4;
+
+	// The list may have moved the window : CASET / RASET are sent again by the next memory write
+	shadow_column_valid = 0;
+	shadow_row_valid = 0;
+}
+
+static void ST7735_BeginData(const uint8_t with_window, const uint8_t xs, const uint8_t xe, const uint8_t ys, const uint8_t ye,
+		const uint8_t command) {
+	// CASET + RASET + command in one CS burst, CS is left low and DC high for the data that follows
+	// Invalid column / row ranges are skipped, as in ST7735_SetColumnAddress / ST7735_SetRowAddress
+	// CASET / RASET are also skipped when the controller already holds the same range (RAMWR restarts from the window origin)
+	uint8_t list[16];
+	uint8_t* entry = list;
+
+	if (with_window && xe >= xs && xe <= display_width-1
+			&& !(shadow_column_valid && xs == shadow_xs && xe == shadow_xe)) {
+		*(entry++) = CASET; *(entry++) = 4;
+		*(entry++) = 0; *(entry++) = xs; *(entry++) = 0; *(entry++) = xe;
+
+		shadow_column_valid = 1;
+		shadow_xs = xs;
+		shadow_xe = xe;
+	}
+
+	if (with_window && ye >= ys && ye <= display_height-1
+			&& !(shadow_row_valid && ys == shadow_ys && ye == shadow_ye)) {
+		*(entry++) = RASET; *(entry++) = 4;
+		*(entry++) = 0; *(entry++) = ys; *(entry++) = 0; *(entry++) = ye;
+
+		shadow_row_valid = 1;
+		shadow_ys = ys;
+		shadow_ye = ye;
+	}
+
+	*(entry++) = command; *(entry++) = 0;
+	*(entry) = ST7735_CMD_END;
+
+	// Set CS low
+	GPIOA->ODR &= ~GPIO_ODR_OD4;
+
+	ST7735_StreamCommandList(list);
+
+	// DC has to be high (data)
+	GPIOA->ODR |= GPIO_ODR_OD9;
+}
+
 void ST7735_WriteByte(const uint8_t byte) {
 	// Transmit only mode
 	SPI1->CR1 |= SPI_CR1_BIDIOE;
@@ -208,6 +637,9 @@ void ST7735_WriteWord(const uint16_t word) {
 void ST7735_ReadBytes(const uint8_t address, uint8_t* bytes, const uint8_t n) {
 	// When reading we must disable SPI then re-enable it in order to generate clock signal
 
+	// Whole read transaction (command included) runs at the read clock
+	ST7735_SetPrescaler(spi_br_read);
+
 	//////////////////////////////////////////// Sending the address of the register we want to read
 	//											 Not using the existing ST7735_SendCommand function because we want CS to remain low
 	// Command => DC Low
@@ -264,6 +696,9 @@ void ST7735_ReadBytes(const uint8_t address, uint8_t* bytes, const uint8_t n) {
 
 	// Back to Transmit only mode
 	SPI1->CR1 |= SPI_CR1_BIDIOE;
+
+	// Back to the write clock
+	ST7735_SetPrescaler(spi_br_write);
 }
 
 void ST7735_WriteBytes(const uint8_t address, const uint8_t* bytes, const uint32_t n) {
@@ -276,15 +711,8 @@ void ST7735_WriteBytes(const uint8_t address, const uint8_t* bytes, const uint32
 	// Set CS low
 	GPIOA->ODR &= ~GPIO_ODR_OD4;
 
-	// Loop through bytes
-	for (uint32_t i = 0; i < n; ++i) {
-
-		// wait for TX buffer to empty
-		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
-
-		// write byte
-		*(__IO uint8_t*)&SPI1->DR = *(bytes + i);
-	}
+	// Two bytes per DR access
+	ST7735_TransmitBytes(bytes, n);
 
 	// wait while SPI is busy
 	while((SPI1->SR & SPI_SR_BSY) != 0);
@@ -294,47 +722,437 @@ void ST7735_WriteBytes(const uint8_t address, const uint8_t* bytes, const uint32
 }
 
 /////////////////////////////////////////////// Function to fill the LCD RAM
-void ST7735_MemoryWrite(const uint8_t* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size,
+void ST7735_MemoryWrite(const void* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size,
 		const uint8_t x_start, const uint8_t y_start) {
-	// Writing to the LCD frame memory with RGB format 6-6-6
-	// Note that for other formats like 4-4-4 or 5-6-5, the data transmission is different
+	// Writing to the LCD frame memory with the current pixel format
+	// 6-6-6 : buffer holds 3 bytes per pixel
+	// 5-6-5 : buffer holds one (half-word aligned) uint16_t per pixel
+	// 4-4-4 : buffer holds 2 pixels per 3 bytes (see ST7735_Pack444)
+	// Images crossing the right / bottom edge are clipped to the visible part
+	// (in 4-4-4 format, only images with an even width and an even visible width : rows must start on a byte)
+
+	if (ST7735_ClipSize(x_start, frame_x_size, display_width) != frame_x_size
+			|| ST7735_ClipSize(y_start, frame_y_size, display_height) != frame_y_size) {
+		if (!ST7735_RegionAligned(0, frame_x_size, frame_y_size)) return;
+
+		ST7735_MemoryWriteRegion(buffer, ST7735_GetFrameSize(frame_x_size), 0, 0, frame_x_size, frame_y_size, x_start, y_start);
+		return;
+	}
 
 	// Calculate end point
 	const uint8_t x_end = x_start + frame_x_size -1;
 	const uint8_t y_end = y_start + frame_y_size -1;
 
-	// Set memory zone to write to
-	ST7735_SetColumnAddress(x_start, x_end);
-	ST7735_SetRowAddress(y_start, y_end);
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
+	// Full color update
+	ST7735_ExitLowPower(0);
+
+	// Set memory zone to write to, then RAMWR
+	ST7735_BeginData(1, x_start, x_end, y_start, y_end, RAMWR);
 
 	// Write to controller memory
-	ST7735_WriteBytes(RAMWR, buffer, frame_x_size*frame_y_size*3);
+	ST7735_WritePixels((const uint8_t*)buffer, 0, frame_x_size*frame_y_size, 1);
 }
 
-void ST7735_MemoryWriteDMA(const uint8_t* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size,
-		const uint8_t x_start, const uint8_t y_start) {
-	// Writing to the LCD frame memory with RGB format 6-6-6
-	// Note that for other formats like 4-4-4 or 5-6-5, the data transmission is different
+void ST7735_MemoryWriteRegion(const void* buffer, const uint32_t stride, const uint8_t src_x, const uint8_t src_y,
+		const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start) {
+	// Writing a frame_x_size * frame_y_size region of a larger source image, whose rows are stride bytes apart
+	// The region starts at (src_x, src_y) in the source image
+	// In 4-4-4 format, src_x and the visible width must be even so that rows start on a byte (nothing is sent otherwise)
+	// The region is clipped to the logical display bounds
+
+	const uint8_t width = ST7735_ClipSize(x_start, frame_x_size, display_width);
+	const uint8_t height = ST7735_ClipSize(y_start, frame_y_size, display_height);
+	if (width == 0 || height == 0 || !ST7735_RegionAligned(src_x, width, height)) return;
 
-	// Configure DMA source address and data count
-	if(ST7735_ConfigDMA((uint32_t)buffer, frame_x_size*frame_y_size*3) == 0) return;
+	const uint8_t* first_row = (const uint8_t*)buffer + src_y * stride + ST7735_GetFrameSize(src_x);
 
 	// Calculate end point
-	const uint8_t x_end = x_start + frame_x_size -1;
-	const uint8_t y_end = y_start + frame_y_size -1;
+	const uint8_t x_end = x_start + width -1;
+	const uint8_t y_end = y_start + height -1;
 
-	// Set memory zone to write to
-	ST7735_SetColumnAddress(x_start, x_end);
-	ST7735_SetRowAddress(y_start, y_end);
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
 
-	// Write to RAM
-	ST7735_SendCommand(RAMWR);
+	// Full color update
+	ST7735_ExitLowPower(0);
 
-	// DC has to be high (data)
-	GPIOA->ODR |= GPIO_ODR_OD9;
+	// Set memory zone to write to, then RAMWR
+	ST7735_BeginData(1, x_start, x_end, y_start, y_end, RAMWR);
 
-	// Set CS low
-	GPIOA->ODR &= ~GPIO_ODR_OD4;
+	// Write to controller memory, one row at a time under a single RAMWR
+	ST7735_WritePixels(first_row, stride, width, height);
+}
+
+ST7735_Handle ST7735_MemoryWriteDMA(const void* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size,
+		const uint8_t x_start, const uint8_t y_start) {
+	// Writing to the LCD frame memory with the current pixel format
+	// 6-6-6 : 8 bit DMA transfers, 3 per pixel
+	// 5-6-5 : 16 bit DMA transfers and 16 bit SPI frames, 1 per pixel
+	// 4-4-4 : 8 bit DMA transfers, 3 per pair of pixels
+	// Images crossing the right / bottom edge are clipped (sent row by row)
+	// (in 4-4-4 format, only images with an even width and an even visible width : rows must start on a byte)
+
+	if (ST7735_ClipSize(x_start, frame_x_size, display_width) != frame_x_size
+			|| ST7735_ClipSize(y_start, frame_y_size, display_height) != frame_y_size) {
+		if (!ST7735_RegionAligned(0, frame_x_size, frame_y_size)) return 0;
+
+		return ST7735_SubmitRegion(buffer, ST7735_GetFrameSize(frame_x_size), 0, 0, frame_x_size, frame_y_size, x_start, y_start, 0);
+	}
+
+	const uint32_t pixel_count = frame_x_size*frame_y_size;
+
+	struct ST7735_Transaction transaction = {
+			.xs = x_start,
+			.xe = x_start + frame_x_size -1,
+			.ys = y_start,
+			.ye = y_start + frame_y_size -1,
+			.command = RAMWR,
+			.half_word = (pixel_format == PIXEL_FORMAT_565),
+			.payload = buffer,
+	};
+	transaction.count = transaction.half_word ? pixel_count : ST7735_GetFrameSize(pixel_count);
+
+	// The transfer starts right away if the bus is idle, otherwise when the previous transactions are done
+	return ST7735_Submit(&transaction);
+}
+
+ST7735_Handle ST7735_MemoryWriteRegionDMA(const void* buffer, const uint32_t stride, const uint8_t src_x, const uint8_t src_y,
+		const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start) {
+	// Same as ST7735_MemoryWriteRegion, one DMA transfer per row
+	// Rows are chained from the transfer complete interrupt with CS held low, under a single RAMWR
+
+	return ST7735_SubmitRegion(buffer, stride, src_x, src_y, frame_x_size, frame_y_size, x_start, y_start, 0);
+}
+
+static ST7735_Handle ST7735_SubmitRegion(const void* buffer, const uint32_t stride, const uint8_t src_x, const uint8_t src_y,
+		const uint8_t frame_x_size, const uint8_t frame_y_size, const uint8_t x_start, const uint8_t y_start, const uint8_t flags) {
+	// Strided RAMWR transaction, clipped to the logical display bounds
+
+	const uint8_t width = ST7735_ClipSize(x_start, frame_x_size, display_width);
+	const uint8_t height = ST7735_ClipSize(y_start, frame_y_size, display_height);
+
+	// Nothing to queue, handle 0 is always done
+	if (width == 0 || height == 0 || !ST7735_RegionAligned(src_x, width, height)) return 0;
+
+	struct ST7735_Transaction transaction = {
+			.xs = x_start,
+			.xe = x_start + width -1,
+			.ys = y_start,
+			.ye = y_start + height -1,
+			.command = RAMWR,
+			.half_word = (pixel_format == PIXEL_FORMAT_565),
+			.flags = flags,
+			.payload = (const uint8_t*)buffer + src_y * stride + ST7735_GetFrameSize(src_x),
+			.stride = stride,
+			.rows = height,
+	};
+	transaction.count = transaction.half_word ? width : ST7735_GetFrameSize(width);
+
+	return ST7735_Submit(&transaction);
+}
+
+static uint8_t ST7735_ClipSize(const uint8_t start, const uint32_t size, const uint8_t limit) {
+	// Number of pixels of [start, start + size) inside [0, limit)
+	if (start >= limit) return 0;
+	return (size > (uint32_t)(limit - start)) ? (uint32_t)(limit - start) : size;
+}
+
+static uint8_t ST7735_RegionAligned(const uint8_t src_x, const uint8_t width, const uint8_t height) {
+	// In 4-4-4 format, 2 pixels share 3 bytes : each row of a strided region must start on a byte,
+	// so src_x must be even, and so must the row width when there are several rows
+	if (pixel_format != PIXEL_FORMAT_444) return 1;
+	return (src_x & 0x01) == 0 && (height == 1 || (width & 0x01) == 0);
+}
+
+ST7735_Handle ST7735_FillRectangleDMA(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end, const uint32_t color)
+{
+	// Same as ST7735_DrawRectangle, but returns right away : a line pattern is streamed by DMA1 Channel 3,
+	// re-armed from the transfer complete interrupt until every pixel is sent
+	// Note that last row / columns index is included
+
+	// Nothing to queue, handle 0 is always done
+	if (x_end < x_start || y_end < y_start) return 0;
+
+	// Clipped to the logical display bounds
+	const uint8_t width = ST7735_ClipSize(x_start, x_end - x_start + 1, display_width);
+	const uint8_t height = ST7735_ClipSize(y_start, y_end - y_start + 1, display_height);
+	if (width == 0 || height == 0) return 0;
+
+	const uint32_t size = width * height;
+	const uint32_t rows = (size + ST7735_FILL_PATTERN_PIXELS - 1) / ST7735_FILL_PATTERN_PIXELS;
+	const uint32_t last_pixels = size - (rows - 1) * ST7735_FILL_PATTERN_PIXELS;
+
+	struct ST7735_Transaction transaction = {
+			.xs = x_start,
+			.xe = x_start + width - 1,
+			.ys = y_start,
+			.ye = y_start + height - 1,
+			.command = RAMWR,
+			.half_word = (pixel_format == PIXEL_FORMAT_565),
+			.flags = ST7735_TRANSACTION_FILL,
+			.color = color,
+			.stride = 0,
+			.rows = rows,
+	};
+
+	if (transaction.half_word) {
+		transaction.count = ST7735_FILL_PATTERN_PIXELS;
+		transaction.last_count = last_pixels;
+	}
+	else {
+		transaction.count = ST7735_GetFrameSize(ST7735_FILL_PATTERN_PIXELS);
+		transaction.last_count = ST7735_GetFrameSize(last_pixels);
+	}
+
+	return ST7735_Submit(&transaction);
+}
+
+ST7735_Handle ST7735_RenderBandsDMA(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end,
+		const uint16_t band_lines, uint8_t* buffer, const ST7735_BandRenderer renderer, void* context)
+{
+	// Streams the window under a single RAMWR, band_lines scanlines at a time
+	// buffer holds two bands (2 * ST7735_GetFrameSize(width * band_lines) bytes, half-word aligned in 5-6-5) :
+	// the renderer fills one of them (from the DMA interrupt) while DMA1 Channel 3 sends the other
+	// In 4-4-4 format, width * band_lines must be even
+	// Note that last row / columns index is included
+
+	if (x_end < x_start || y_end < y_start || band_lines == 0) return 0;
+
+	// Clipped to the logical display bounds, the renderer only sees the visible lines
+	const uint32_t width = ST7735_ClipSize(x_start, x_end - x_start + 1, display_width);
+	const uint32_t lines = ST7735_ClipSize(y_start, y_end - y_start + 1, display_height);
+	if (width == 0 || lines == 0) return 0;
+
+	const uint32_t bands = (lines + band_lines - 1) / band_lines;
+	const uint32_t last_lines = lines - (bands - 1) * band_lines;
+
+	struct ST7735_Transaction transaction = {
+			.xs = x_start,
+			.xe = x_start + width - 1,
+			.ys = y_start,
+			.ye = y_start + lines - 1,
+			.command = RAMWR,
+			.half_word = (pixel_format == PIXEL_FORMAT_565),
+			.flags = ST7735_TRANSACTION_BANDS,
+			.payload = buffer,
+			.stride = ST7735_GetFrameSize(width * band_lines),
+			.rows = bands,
+			.band_lines = band_lines,
+			.renderer = renderer,
+			.context = context,
+	};
+
+	if (transaction.half_word) {
+		transaction.count = width * band_lines;
+		transaction.last_count = width * last_lines;
+	}
+	else {
+		transaction.count = ST7735_GetFrameSize(width * band_lines);
+		transaction.last_count = ST7735_GetFrameSize(width * last_lines);
+	}
+
+	return ST7735_Submit(&transaction);
+}
+
+static void ST7735_RenderBand(const struct ST7735_Transaction* transaction, const uint32_t band, const uint32_t half) {
+	const uint16_t first_line = band * transaction->band_lines;
+	const uint16_t lines_left = (transaction->ye - transaction->ys + 1) - first_line;
+	const uint16_t lines = (lines_left < transaction->band_lines) ? lines_left : transaction->band_lines;
+
+	uint8_t* buffer = (uint8_t*)transaction->payload + half * transaction->stride;
+
+	transaction->renderer(transaction->context, buffer, first_line, lines);
+}
+
+static uint32_t ST7735_StartBands(const struct ST7735_Transaction* transaction) {
+	// First run : band 0 in the first buffer, band 1 (if any) in the second one
+	ST7735_RenderBand(transaction, 0, 0);
+	uint32_t count = ST7735_RowCount(transaction, 0);
+
+	band_next = 1;
+	band_pair = 0;
+
+	if (band_next < transaction->rows) {
+		ST7735_RenderBand(transaction, band_next, 1);
+		count += ST7735_RowCount(transaction, band_next);
+		++band_next;
+		band_pair = 1;
+	}
+
+	band_refilled = 0;
+
+	return count;
+}
+
+static void ST7735_BandHalfTransfer(const struct ST7735_Transaction* transaction) {
+	// First buffer is sent, the second one is on the bus : refill the first one
+	// HT fires early when the second band of the run is a shorter last band, but then nothing is left to render
+	if (band_next >= transaction->rows) return;
+
+	ST7735_RenderBand(transaction, band_next, 0);
+	band_refilled = 1;
+}
+
+static uint32_t ST7735_BandTransferComplete(const struct ST7735_Transaction* transaction) {
+	// Both buffers are sent, returns 0 when the transaction is complete
+	if (!band_refilled) return 0;
+
+	// Restart from the first buffer, rendered during the half transfer
+	// Re-armed rather than circular so that the last (shorter) band ends the RAMWR exactly
+	const uint32_t first_band = band_next++;
+	uint32_t count = ST7735_RowCount(transaction, first_band);
+
+	band_pair = (band_next < transaction->rows);
+	if (band_pair) count += ST7735_RowCount(transaction, band_next);
+
+	band_refilled = 0;
+
+	DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+	DMA1_Channel3->CMAR = (uint32_t)transaction->payload;
+	DMA1_Channel3->CNDTR = count;
+	if (band_pair) DMA1_Channel3->CCR |= DMA_CCR_HTIE;
+	else DMA1_Channel3->CCR &= ~DMA_CCR_HTIE;
+	DMA1_Channel3->CCR |= DMA_CCR_EN;
+
+	// Second buffer is rendered while the first one is on the bus
+	if (band_pair) ST7735_RenderBand(transaction, band_next++, 1);
+
+	return 1;
+}
+
+/////////////////////////////////////////////// Transaction queue
+ST7735_Handle ST7735_Submit(const struct ST7735_Transaction* transaction) {
+	// Blocks while the queue is full : don't call with interrupts disabled or from an ISR with a higher priority than DMA1 Channel 3
+	// Wait for a free slot, the DMA ISR keeps draining the queue in the meantime
+	while(queue_count == ST7735_QUEUE_SIZE);
+
+	const ST7735_Handle handle = ++queue_last_handle;
+
+	struct ST7735_Transaction* entry = &queue[queue_tail];
+	*entry = *transaction;
+	entry->handle = handle;
+
+	// Publish the entry, start the queue if the bus is idle
+	const uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	queue_tail = (queue_tail + 1) % ST7735_QUEUE_SIZE;
+	++queue_count;
+
+	const uint8_t start = (queue_running == 0);
+	queue_running = 1;
+
+	__set_PRIMASK(primask);
+
+	// Only this context can start the queue when it's not running, no need to hold the interrupts off
+	if (start) ST7735_LaunchTransaction();
+
+	return handle;
+}
+
+uint32_t ST7735_IsDone(const ST7735_Handle handle) {
+	// Handles complete in order, wrap-around safe comparison
+	return (int32_t)(queue_done_handle - handle) >= 0;
+}
+
+void ST7735_Wait(const ST7735_Handle handle) {
+	while(ST7735_IsDone(handle) == 0);
+}
+
+void ST7735_WaitIdle(void) {
+	while(queue_running != 0);
+}
+
+static uint32_t ST7735_RowCount(const struct ST7735_Transaction* transaction, const uint32_t row) {
+	// Number of DMA transfers for a given row, the last one can be shorter
+	const uint32_t last_row = (transaction->rows > 1) ? transaction->rows - 1 : 0;
+
+	if (row == last_row && transaction->last_count != 0) return transaction->last_count;
+	return transaction->count;
+}
+
+static void ST7735_BuildFillPattern(const uint32_t color) {
+	// One line of ST7735_FILL_PATTERN_PIXELS pixels of the same color, in the current pixel format
+	uint8_t* bytes = (uint8_t*)fill_pattern;
+
+	if (pixel_format == PIXEL_FORMAT_565) {
+		uint16_t* half_words = (uint16_t*)fill_pattern;
+		for (uint32_t i = 0; i < ST7735_FILL_PATTERN_PIXELS; ++i) *(half_words + i) = (uint16_t)color;
+		return;
+	}
+
+	uint8_t unit[3];
+	uint32_t units = ST7735_FILL_PATTERN_PIXELS;
+
+	if (pixel_format == PIXEL_FORMAT_444) {
+		// Same pixel twice => RG BR GB
+		const uint16_t pixels[] = { (uint16_t)color, (uint16_t)color };
+		ST7735_Pack444(unit, pixels, 2);
+		units = ST7735_FILL_PATTERN_PIXELS / 2;
+	}
+	else {
+		unit[0] = ((color & 0x3F000) >> 12) << 2;
+		unit[1] = ((color & 0xFC0) >> 6) << 2;
+		unit[2] = (color & 0x3F) << 2;
+	}
+
+	for (uint32_t i = 0; i < units; ++i) {
+		*(bytes++) = unit[0];
+		*(bytes++) = unit[1];
+		*(bytes++) = unit[2];
+	}
+}
+
+static void ST7735_LaunchTransaction(void) {
+	// Synchronized transactions are started by the TE interrupt, at the beginning of the vertical blanking
+	if ((queue[queue_head].flags & ST7735_TRANSACTION_VSYNC) && te_enabled) {
+		te_waiting = 1;
+		return;
+	}
+
+	ST7735_StartTransaction();
+}
+
+static void ST7735_StartTransaction(void) {
+	struct ST7735_Transaction* transaction = &queue[queue_head];
+
+	// Fills stream the same line pattern over and over
+	if (transaction->flags & ST7735_TRANSACTION_FILL) {
+		ST7735_BuildFillPattern(transaction->color);
+		transaction->payload = fill_pattern;
+	}
+
+	// Short parameter lists are carried by the transaction itself
+	if (transaction->flags & ST7735_TRANSACTION_INLINE) transaction->payload = transaction->data;
+
+	// Full color updates bring the panel back to normal mode
+	if (transaction->command == RAMWR) ST7735_ExitLowPower(transaction->flags);
+
+	queue_row = 0;
+	queue_row_address = (uint32_t)transaction->payload;
+
+	// Band transactions render their first two bands before the first DMA run
+	const uint32_t first_count = (transaction->flags & ST7735_TRANSACTION_BANDS) ?
+			ST7735_StartBands(transaction) : ST7735_RowCount(transaction, 0);
+
+	// Configure DMA source address and data count (bus is idle at this point)
+	ST7735_ConfigDMA(queue_row_address, first_count, transaction->half_word);
+
+	// Half transfer interrupt is only used by band transactions
+	DMA1_Channel3->CCR &= ~DMA_CCR_HTIE;
+	if (band_pair) DMA1_Channel3->CCR |= DMA_CCR_HTIE;
+
+	// Set memory zone to write to, then write to RAM (or any other register), in a single CS burst
+	ST7735_BeginData(!(transaction->flags & ST7735_TRANSACTION_NO_WINDOW),
+			transaction->xs, transaction->xe, transaction->ys, transaction->ye, transaction->command);
+
+	// 16 bit SPI frames for 5-6-5 payloads, set back to 8 bits in the ISR
+	if (transaction->half_word) ST7735_SetDataSize16();
+
+	flag__dma1_channel3_done = 0;
 
 	// Enable DMA1_Channel3
 	DMA1_Channel3->CCR |= DMA_CCR_EN;
@@ -342,11 +1160,357 @@ void ST7735_MemoryWriteDMA(const uint8_t* buffer, const uint8_t frame_x_size, co
 	// Enable TX DMA requests
 	SPI1->CR2 |= SPI_CR2_TXDMAEN;
 
-	flag__dma1_channel3_done = 0;
-
 	// DMA is now handling the data transfer from our frame_buffer to the SPI peripheral
 
-	// Disabling DMA after transfer complete and setting CS back to high is done in the ISR (find code in stm32l4xx_it.c)
+	// Disabling DMA after transfer complete and setting CS back to high is done in ST7735_DMA_IRQHandler
+}
+
+void ST7735_DMA_IRQHandler(void) {
+	// This code should be executed every time the DMA is done copying a transaction payload
+	const struct ST7735_Transaction* transaction = &queue[queue_head];
+
+	// Half transfer : first band buffer of a band transaction is free
+	if ((DMA1->ISR & DMA_ISR_HTIF3) == DMA_ISR_HTIF3) {
+		DMA1->IFCR |= DMA_IFCR_CHTIF3;
+		if (transaction->flags & ST7735_TRANSACTION_BANDS) ST7735_BandHalfTransfer(transaction);
+	}
+
+	// Test interrupt source (transfer complete)
+	if ((DMA1->ISR & DMA_ISR_TCIF3) != DMA_ISR_TCIF3) return;
+
+	// Clear interrupt bit
+	DMA1->IFCR |= DMA_IFCR_CTCIF3;
+
+	// Band transaction : next run (if any) is started under the same RAMWR
+	if ((transaction->flags & ST7735_TRANSACTION_BANDS) && ST7735_BandTransferComplete(transaction)) return;
+
+	// Strided transaction : next row, CS stays low and the SPI keeps its DMA requests enabled
+	if (!(transaction->flags & ST7735_TRANSACTION_BANDS) && ++queue_row < transaction->rows) {
+		queue_row_address += transaction->stride;
+
+		DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+		DMA1_Channel3->CMAR = queue_row_address;
+		DMA1_Channel3->CNDTR = ST7735_RowCount(transaction, queue_row);
+		DMA1_Channel3->CCR |= DMA_CCR_EN;
+		return;
+	}
+
+	// wait while SPI1 BSY flag is set
+	while((SPI1->SR & SPI_SR_BSY) == SPI_SR_BSY);
+
+	// Set CS high
+	GPIOA->ODR |= GPIO_ODR_OD4;
+
+	// Disable SPI1 TX DMA requests
+	SPI1->CR2 &= ~SPI_CR2_TXDMAEN;
+
+	// Disable DMA1 Channel 3
+	DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+
+	// Back to 8 bit SPI frames in case a 5-6-5 payload was sent
+	SPI1->CR2 &= ~(0x08 << SPI_CR2_DS_Pos);
+
+	flag__dma1_channel3_done = 1;
+
+	// Retire the transaction
+	queue_done_handle = transaction->handle;
+	queue_head = (queue_head + 1) % ST7735_QUEUE_SIZE;
+	--queue_count;
+
+	// Chain directly into the next one
+	if (queue_count != 0) ST7735_LaunchTransaction();
+	else queue_running = 0;
+}
+
+
+/////////////////////////////////////////////// Vertical scrolling
+void ST7735_SetScrollArea(const uint8_t top_fixed, const uint8_t bottom_fixed) {
+	// Lines [top_fixed, ST7735_SCROLL_HEIGHT - bottom_fixed) scroll, the others stay in place
+	if (top_fixed + bottom_fixed >= ST7735_SCROLL_HEIGHT) return;
+
+	const uint8_t height = ST7735_SCROLL_HEIGHT - top_fixed - bottom_fixed;
+
+	if (top_fixed != scroll_top || height != scroll_height) {
+		// The bus is shared with the DMA transactions
+		ST7735_WaitIdle();
+
+		scroll_top = top_fixed;
+		scroll_height = height;
+
+		// TFA, VSA, BFA (MSB first)
+		const uint8_t bytes[] = {
+				0, scroll_top, 0, scroll_height, 0, bottom_fixed
+		};
+
+		ST7735_WriteBytes(SCRLAR, bytes, 6);
+	}
+
+	// Back to no scrolling
+	ST7735_SetScrollStart(scroll_top);
+}
+
+void ST7735_SetScrollStart(const uint8_t line) {
+	// GRAM line displayed at the top of the scroll area
+	if (line < scroll_top || line >= scroll_top + scroll_height) return;
+
+	// Already there
+	if (line == scroll_start) return;
+
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
+	scroll_start = line;
+
+	const uint8_t bytes[] = {
+			0, line
+	};
+
+	ST7735_WriteBytes(VSCSAD, bytes, 2);
+}
+
+uint8_t ST7735_GetScrollStart(void) {
+	return scroll_start;
+}
+
+ST7735_Handle ST7735_ScrollLines(const uint8_t lines, const void* rows) {
+	// Scrolls the scroll area content up by 'lines', then writes the newly exposed bottom rows
+	// rows holds 'lines' full display rows (DISPLAY_WIDTH pixels each) in the current pixel format,
+	// it must stay valid until the returned handle is done
+	// Only the new rows go on the bus : they're written to the GRAM lines that just wrapped around
+
+	// The rows are written with logical coordinates, which only match GRAM lines when MV and MY are clear
+	// (ORIENTATION_0, or ORIENTATION_180 with a Y mirror)
+	if (lines == 0 || lines > scroll_height || (shadow_madctl & (MADCTL_MV | MADCTL_MY))) return 0;
+
+	const uint8_t first_line = scroll_start;
+	const uint32_t row_size = ST7735_GetFrameSize(DISPLAY_WIDTH);
+
+	scroll_start = scroll_top + (scroll_start - scroll_top + lines) % scroll_height;
+
+	// Move the scroll start address, queued so that it runs in order with the row writes
+	struct ST7735_Transaction transaction = {
+			.command = VSCSAD,
+			.flags = ST7735_TRANSACTION_INLINE | ST7735_TRANSACTION_NO_WINDOW,
+			.data = { 0, scroll_start },
+			.count = 2,
+	};
+	ST7735_Submit(&transaction);
+
+	// The lines that were at the top of the scroll area are now at the bottom
+	// They may wrap at the end of the scroll area => up to two windows
+	const uint8_t area_end = scroll_top + scroll_height;
+	const uint8_t first_part = (first_line + lines > area_end) ? area_end - first_line : lines;
+
+	ST7735_Handle handle = ST7735_MemoryWriteRegionDMA(rows, row_size, 0, 0, DISPLAY_WIDTH, first_part, 0, first_line);
+
+	if (first_part < lines) {
+		handle = ST7735_MemoryWriteRegionDMA(rows, row_size, 0, first_part, DISPLAY_WIDTH, lines - first_part, 0, scroll_top);
+	}
+
+	return handle;
+}
+
+/////////////////////////////////////////////// Power profiles
+void ST7735_SetPartialArea(const uint8_t start_line, const uint8_t end_line) {
+	// Lines refreshed in partial mode (last line included), the others show the background
+	if (end_line > DISPLAY_HEIGHT-1) return;
+	if (start_line == partial_start && end_line == partial_end) return;
+
+	partial_start = start_line;
+	partial_end = end_line;
+
+	// Applied right away if partial mode is on
+	if (power_profile == POWER_PARTIAL || power_profile == POWER_PARTIAL_IDLE) {
+		const uint8_t bytes[] = {
+				0, partial_start, 0, partial_end
+		};
+
+		// The bus is shared with the DMA transactions
+		ST7735_WaitIdle();
+
+		ST7735_WriteBytes(PTLAR, bytes, 4);
+	}
+}
+
+void ST7735_SetIdleFrameRate(const uint8_t rtna, const uint8_t fpa, const uint8_t bpa) {
+	// FRMCTR2 : frame rate = fosc / ((RTNA * 2 + 40) * (lines + FPA + BPA)), used in idle mode
+	const uint8_t bytes[] = {
+			rtna & 0x0F, fpa & 0x3F, bpa & 0x3F
+	};
+
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
+	ST7735_WriteBytes(FRMCTR2, bytes, 3);
+}
+
+void ST7735_SetPartialFrameRate(const uint8_t rtnc, const uint8_t fpc, const uint8_t bpc) {
+	// FRMCTR3 : same as FRMCTR2, used in partial mode with full colors (dot and column inversion modes)
+	const uint8_t bytes[] = {
+			rtnc & 0x0F, fpc & 0x3F, bpc & 0x3F,
+			rtnc & 0x0F, fpc & 0x3F, bpc & 0x3F
+	};
+
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
+	ST7735_WriteBytes(FRMCTR3, bytes, 6);
+}
+
+void ST7735_SetPowerProfile(const enum POWER_PROFILE profile) {
+	// POWER_NORMAL : full screen, full colors
+	// POWER_PARTIAL : only the partial area is refreshed
+	// POWER_IDLE : full screen, 8 colors (MSB of each component), FRMCTR2 frame rate
+	// POWER_PARTIAL_IDLE : partial area, 8 colors
+	// Queuing a RAMWR transaction without ST7735_TRANSACTION_LOW_POWER switches back to POWER_NORMAL
+
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
+	// Already in this profile (checked once the queue is idle, a RAMWR may have left low power)
+	if (profile == power_profile) return;
+
+	if (profile == POWER_PARTIAL || profile == POWER_PARTIAL_IDLE) {
+		const uint8_t bytes[] = {
+				0, partial_start, 0, partial_end
+		};
+
+		ST7735_WriteBytes(PTLAR, bytes, 4);
+		ST7735_SendCommand(PTLON);
+	}
+	else {
+		ST7735_SendCommand(NORON);
+	}
+
+	ST7735_SendCommand((profile == POWER_IDLE || profile == POWER_PARTIAL_IDLE) ? IDMON : IDMOFF);
+
+	power_profile = profile;
+}
+
+enum POWER_PROFILE ST7735_GetPowerProfile(void) {
+	return power_profile;
+}
+
+static void ST7735_ExitLowPower(const uint8_t flags) {
+	// Called with the bus free, before a RAMWR
+	if (power_profile == POWER_NORMAL || (flags & ST7735_TRANSACTION_LOW_POWER)) return;
+
+	ST7735_SendCommand(NORON);
+	ST7735_SendCommand(IDMOFF);
+
+	power_profile = POWER_NORMAL;
+}
+
+/////////////////////////////////////////////// Tearing effect synchronization
+void ST7735_SetTearingSync(const uint32_t enable) {
+	// TE output of the controller on PA8 (D7), EXTI line 8 on rising edges (start of V-blanking)
+	// Transactions flagged ST7735_TRANSACTION_VSYNC then start on the next TE edge
+
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
+	if (!enable) {
+		// Mask EXTI line 8
+		EXTI->IMR1 &= ~EXTI_IMR1_IM8;
+
+		ST7735_SendCommand(TEOFF);
+		te_enabled = 0;
+		return;
+	}
+
+	// Cycle counter for the presentation timestamps
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	// PA8 as input
+	GPIOA->MODER &= ~GPIO_MODER_MODE8_Msk;
+
+	// Map EXTI line 8 to PA8
+	RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+	SYSCFG->EXTICR[2] &= ~SYSCFG_EXTICR3_EXTI8;
+
+	// Rising edge, unmask EXTI line 8
+	EXTI->RTSR1 |= EXTI_RTSR1_RT8;
+	EXTI->FTSR1 &= ~EXTI_FTSR1_FT8;
+	EXTI->PR1 = EXTI_PR1_PIF8;
+	EXTI->IMR1 |= EXTI_IMR1_IM8;
+
+	// Same priority as DMA1 Channel 3 : both ISRs start transactions, they must not preempt each other
+	NVIC_SetPriority(EXTI9_5_IRQn, 1);
+	NVIC_EnableIRQ(EXTI9_5_IRQn);
+
+	// TE line on, mode 0 : V-blanking information only
+	const uint8_t te_mode = 0x00;
+	ST7735_WriteBytes(TEON, &te_mode, 1);
+
+	te_enabled = 1;
+}
+
+void ST7735_TE_IRQHandler(void) {
+	if ((EXTI->PR1 & EXTI_PR1_PIF8) != EXTI_PR1_PIF8) return;
+
+	// Clear pending bit (write 1)
+	EXTI->PR1 = EXTI_PR1_PIF8;
+
+	const uint32_t now = DWT->CYCCNT;
+	te_period = now - te_last_edge;
+	te_last_edge = now;
+
+	if (!te_waiting) return;
+	te_waiting = 0;
+
+	// Record when the frame actually went on the bus
+	present_timestamps[present_count % ST7735_PRESENT_HISTORY] = now;
+	++present_count;
+
+	ST7735_StartTransaction();
+}
+
+uint32_t ST7735_GetTEPeriod(void) {
+	// Time between the last two TE edges, in CPU cycles
+	return te_period;
+}
+
+uint32_t ST7735_GetPresentTimestamps(uint32_t* timestamps, const uint32_t n) {
+	// Copies up to n of the latest presentation timestamps (CPU cycles, oldest first), returns how many were copied
+	const uint32_t count = present_count;
+	const uint32_t available = (count < ST7735_PRESENT_HISTORY) ? count : ST7735_PRESENT_HISTORY;
+	const uint32_t copied = (n < available) ? n : available;
+
+	for (uint32_t i = 0; i < copied; ++i) {
+		*(timestamps + i) = present_timestamps[(count - copied + i) % ST7735_PRESENT_HISTORY];
+	}
+
+	return copied;
+}
+
+ST7735_Handle ST7735_PresentFrameDMA(const void* buffer, const uint8_t frame_x_size, const uint8_t frame_y_size,
+		const uint8_t x_start, const uint8_t y_start) {
+	// Same as ST7735_MemoryWriteDMA, started on the next TE edge when tearing sync is enabled
+
+	if (ST7735_ClipSize(x_start, frame_x_size, display_width) != frame_x_size
+			|| ST7735_ClipSize(y_start, frame_y_size, display_height) != frame_y_size) {
+		if (!ST7735_RegionAligned(0, frame_x_size, frame_y_size)) return 0;
+
+		return ST7735_SubmitRegion(buffer, ST7735_GetFrameSize(frame_x_size), 0, 0, frame_x_size, frame_y_size, x_start, y_start,
+				ST7735_TRANSACTION_VSYNC);
+	}
+
+	const uint32_t pixel_count = frame_x_size*frame_y_size;
+
+	struct ST7735_Transaction transaction = {
+			.xs = x_start,
+			.xe = x_start + frame_x_size -1,
+			.ys = y_start,
+			.ye = y_start + frame_y_size -1,
+			.command = RAMWR,
+			.half_word = (pixel_format == PIXEL_FORMAT_565),
+			.flags = ST7735_TRANSACTION_VSYNC,
+			.payload = buffer,
+	};
+	transaction.count = transaction.half_word ? pixel_count : ST7735_GetFrameSize(pixel_count);
+
+	return ST7735_Submit(&transaction);
 }
 
 
@@ -395,6 +1559,9 @@ void ST7735_HWReset(void) {
 }
 
 void ST7735_ReadID(uint8_t* id_buffer, const enum WHICH_ID id) {
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
 	switch (id) {
 	case ALL_IDs:
 		// Reading more than a byte requires a dummy clock cycle put by the host after the command / register address
@@ -415,84 +1582,268 @@ void ST7735_ReadID(uint8_t* id_buffer, const enum WHICH_ID id) {
 }
 
 void ST7735_SetColumnAddress(const uint8_t xs, const uint8_t xe) {
-	if (xe < xs || xe > DISPLAY_WIDTH-1) return;
+	// The bus is shared with the DMA transactions, and queued windows update the shadow
+	ST7735_WaitIdle();
+
+	if (xe < xs || xe > display_width-1) return;
+	if (shadow_column_valid && xs == shadow_xs && xe == shadow_xe) return;
 
 	const uint8_t bytes[] = {
 			0, xs, 0, xe
 	};
 
 	ST7735_WriteBytes(CASET, bytes, 4);
+
+	shadow_column_valid = 1;
+	shadow_xs = xs;
+	shadow_xe = xe;
 }
 
 void ST7735_SetRowAddress(const uint8_t ys, const uint8_t ye) {
-	if (ye < ys || ye > DISPLAY_HEIGHT-1) return;
+	// The bus is shared with the DMA transactions, and queued windows update the shadow
+	ST7735_WaitIdle();
+
+	if (ye < ys || ye > display_height-1) return;
+	if (shadow_row_valid && ys == shadow_ys && ye == shadow_ye) return;
 
 	const uint8_t bytes[] = {
 			0, ys, 0, ye
 	};
 
 	ST7735_WriteBytes(RASET, bytes, 4);
+
+	shadow_row_valid = 1;
+	shadow_ys = ys;
+	shadow_ye = ye;
 }
 
 void ST7735_SetMirror(const uint32_t x_mirror, const uint32_t y_mirror)
 {
-	// Read current MADCTL configuration
+	// Mirrors the logical x / y axes, on top of the orientation
+	mirror_x = x_mirror & 0x01;
+	mirror_y = y_mirror & 0x01;
+
+	ST7735_UpdateMADCTL();
+}
+
+void ST7735_SetOrientation(const enum ORIENTATION rotation) {
+	// Clockwise rotation of the picture, logical width and height are exchanged at 90 and 270 degrees
+	// Scrolling and partial areas stay in panel lines (ORIENTATION_0 rows)
+	if (rotation > ORIENTATION_270) return;
+
+	// Queued transactions were clipped for the previous geometry
+	ST7735_WaitIdle();
+
+	orientation = rotation;
+
+	if (orientation_madctl[orientation] & MADCTL_MV) {
+		display_width = DISPLAY_HEIGHT;
+		display_height = DISPLAY_WIDTH;
+	}
+	else {
+		display_width = DISPLAY_WIDTH;
+		display_height = DISPLAY_HEIGHT;
+	}
+
+	ST7735_UpdateMADCTL();
+}
+
+enum ORIENTATION ST7735_GetOrientation(void) {
+	return orientation;
+}
+
+uint8_t ST7735_GetMADCTL(void) {
+	// Orientation and mirrors as programmed (MV / MX / MY), from the shadow
+	return shadow_madctl;
+}
+
+uint8_t ST7735_GetWidth(void) {
+	return display_width;
+}
+
+uint8_t ST7735_GetHeight(void) {
+	return display_height;
+}
+
+static void ST7735_UpdateMADCTL(void) {
+	// MV / MX / MY from the orientation, then the logical mirrors
+	// When rows and columns are exchanged, the logical x axis is the one MY mirrors
+	uint8_t bits = orientation_madctl[orientation];
+
+	if (bits & MADCTL_MV) bits ^= (mirror_x ? MADCTL_MY : 0) | (mirror_y ? MADCTL_MX : 0);
+	else bits ^= (mirror_x ? MADCTL_MX : 0) | (mirror_y ? MADCTL_MY : 0);
+
+	uint8_t madtcl = shadow_madctl;
+	madtcl &= ~(MADCTL_MY | MADCTL_MX | MADCTL_MV);
+	madtcl |= bits;
+
+	// Already programmed
+	if (madtcl == shadow_madctl) return;
+
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
+	// Send to controller
+	ST7735_WriteBytes(MADTCL, &madtcl, 1);
+
+	shadow_madctl = madtcl;
+}
+
+void ST7735_Resync(void) {
+	// Reloads the register shadow from the controller, e.g. after raw ST7735_WriteBytes / ST7735_RunCommandList calls
+	// Slow (read clock + bus turnarounds), not meant for the drawing path
+
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
+
 	uint8_t madtcl = 0;
+	uint8_t colmod = 0;
+	uint8_t power = 0;
+
 	ST7735_ReadBytes(RDDMADTCL, &madtcl, 1);
+	ST7735_ReadBytes(RDDCOLMOD, &colmod, 1);
+	ST7735_ReadBytes(RDDPM, &power, 1);
 
-	// Update with parameters
-	madtcl &= ~0b11000000;
-	madtcl |= ((x_mirror & 0x01) << 6) | ((y_mirror & 0x01) << 7);
+	shadow_madctl = madtcl;
 
-	// Send back to controller
-	ST7735_WriteBytes(MADTCL, &madtcl, 1);
+	// Orientation from MV, MX / MY differences are seen as mirrors
+	orientation = (madtcl & MADCTL_MV) ? ORIENTATION_90 : ORIENTATION_0;
+	display_width = (madtcl & MADCTL_MV) ? DISPLAY_HEIGHT : DISPLAY_WIDTH;
+	display_height = (madtcl & MADCTL_MV) ? DISPLAY_WIDTH : DISPLAY_HEIGHT;
+
+	const uint8_t mirrors = (madtcl ^ orientation_madctl[orientation]) & (MADCTL_MY | MADCTL_MX);
+	if (madtcl & MADCTL_MV) {
+		mirror_x = (mirrors & MADCTL_MY) ? 1 : 0;
+		mirror_y = (mirrors & MADCTL_MX) ? 1 : 0;
+	}
+	else {
+		mirror_x = (mirrors & MADCTL_MX) ? 1 : 0;
+		mirror_y = (mirrors & MADCTL_MY) ? 1 : 0;
+	}
+
+	// IFPF (D2-D0) has the same values as COLMOD
+	shadow_colmod = colmod & 0x07;
+	if (shadow_colmod == PIXEL_FORMAT_444 || shadow_colmod == PIXEL_FORMAT_565 || shadow_colmod == PIXEL_FORMAT_666) {
+		pixel_format = (enum PIXEL_FORMAT)shadow_colmod;
+	}
+	else {
+		// Unknown format, written again by the next ST7735_SetPixelFormat
+		shadow_colmod = 0x00;
+	}
+
+	// D6 : idle mode on, D5 : partial mode on
+	if (power & 0x20) power_profile = (power & 0x40) ? POWER_PARTIAL_IDLE : POWER_PARTIAL;
+	else power_profile = (power & 0x40) ? POWER_IDLE : POWER_NORMAL;
+
+	// CASET / RASET can't be read back : sent again by the next memory write
+	shadow_column_valid = 0;
+	shadow_row_valid = 0;
+
+	// Scroll registers can't be read back either : the driver state is written again
+	const uint8_t scroll_area[] = {
+			0, scroll_top, 0, scroll_height, 0, ST7735_SCROLL_HEIGHT - scroll_top - scroll_height
+	};
+	const uint8_t scroll_address[] = {
+			0, scroll_start
+	};
+
+	ST7735_WriteBytes(SCRLAR, scroll_area, 6);
+	ST7735_WriteBytes(VSCSAD, scroll_address, 2);
 }
 
 void ST7735_DrawRectangle(const uint8_t x_start, const uint8_t y_start, const uint8_t x_end, const uint8_t y_end, const uint32_t color)
 {
 	// Color format:
 	// For 6-6-6 color format:
-	// Use first 18LSBs, upper 6 bits are red, lower 6 bits are blue, send blue component first
+	// Use first 18LSBs, upper 6 bits are red, lower 6 bits are blue, send red component first
+	// For 5-6-5 color format:
+	// Use first 16LSBs, sent as a single 16 bit frame
+	// For 4-4-4 color format:
+	// Use first 12LSBs, two pixels are packed into 3 bytes
+	// The rectangle is clipped to the logical display bounds
 
-	ST7735_SetColumnAddress(x_start, x_end);
-	ST7735_SetRowAddress(y_start, y_end);
+	if (x_end < x_start || y_end < y_start) return;
 
-	const uint32_t size = (x_end - x_start + 1) * (y_end - y_start + 1);
+	const uint8_t width = ST7735_ClipSize(x_start, x_end - x_start + 1, display_width);
+	const uint8_t height = ST7735_ClipSize(y_start, y_end - y_start + 1, display_height);
+	if (width == 0 || height == 0) return;
 
-	// Extract RGB 6-6-6 colors and left shift twice each component
-	const uint8_t bytes[] = { ((color & 0x3F000) >> 12) << 2,
-							((color & 0xFC0) >> 6) << 2,
-							(color & 0x3F) << 2 };
+	// The bus is shared with the DMA transactions
+	ST7735_WaitIdle();
 
-	// Send address we want to write to
-	ST7735_SendCommand(RAMWR);
+	// Full color update
+	ST7735_ExitLowPower(0);
 
-	// DC has to be high (data)
-	GPIOA->ODR |= GPIO_ODR_OD9;
+	const uint32_t size = width * height;
 
-	// Set CS low
-	GPIOA->ODR &= ~GPIO_ODR_OD4;
+	// 3 bytes pattern repeated 'repeat' times
+	uint8_t bytes[3];
+	uint32_t repeat = size;
 
-	// Loop through bytes
-	for (uint32_t i = 0; i < size; ++i) {
+	if (pixel_format == PIXEL_FORMAT_444) {
+		// Same pixel twice => RG BR GB
+		const uint16_t pixels[] = { (uint16_t)color, (uint16_t)color };
+		ST7735_Pack444(bytes, pixels, 2);
+		repeat = size / 2;
+	}
+	else {
+		// Extract RGB 6-6-6 colors and left shift twice each component
+		bytes[0] = ((color & 0x3F000) >> 12) << 2;
+		bytes[1] = ((color & 0xFC0) >> 6) << 2;
+		bytes[2] = (color & 0x3F) << 2;
+	}
 
-		// wait for TX buffer to empty
+	// Set memory zone to write to, then RAMWR
+	ST7735_BeginData(1, x_start, x_start + width - 1, y_start, y_start + height - 1, RAMWR);
+
+	if (pixel_format == PIXEL_FORMAT_565) {
+		ST7735_SetDataSize16();
+
+		for (uint32_t i = 0; i < size; ++i) {
+
+			// wait for TX buffer to empty
+			while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+
+			// write pixel
+			SPI1->DR = (uint16_t)color;
+		}
+
+		// Back to 8 bit frames (waits for BSY)
+		ST7735_SetDataSize8();
+
+		// Set CS high
+		GPIOA->ODR |= GPIO_ODR_OD4;
+		return;
+	}
+
+	// The pattern repeated twice is 3 half-words : two packed bytes per DR access
+	const uint16_t pair[] = {
+			(uint16_t)(bytes[0] | (bytes[1] << 8)),
+			(uint16_t)(bytes[2] | (bytes[0] << 8)),
+			(uint16_t)(bytes[1] | (bytes[2] << 8)),
+	};
+
+	for (uint32_t i = 0; i < repeat / 2; ++i) {
 		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint16_t*)&SPI1->DR = pair[0];
 
-		// write red byte
-		*(__IO uint8_t*)&SPI1->DR = *(bytes);
+		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint16_t*)&SPI1->DR = pair[1];
 
-		// wait for TX buffer to empty
 		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint16_t*)&SPI1->DR = pair[2];
+	}
 
-		// write green byte
-		*(__IO uint8_t*)&SPI1->DR = *(bytes + 1);
+	// Odd repeat count
+	if ((repeat & 0x01) != 0) ST7735_TransmitBytes(bytes, 3);
 
-		// wait for TX buffer to empty
+	// 4-4-4 with an odd pixel count : last pixel is RG B(pad)
+	if (pixel_format == PIXEL_FORMAT_444 && (size & 0x01) != 0) {
 		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint8_t*)&SPI1->DR = *(bytes);
 
-		// write blue byte
-		*(__IO uint8_t*)&SPI1->DR = *(bytes + 2);
+		while((SPI1->SR & SPI_SR_TXE) != SPI_SR_TXE);
+		*(__IO uint8_t*)&SPI1->DR = *(bytes + 1) & 0xF0;
 	}
 
 	// wait while SPI is busy
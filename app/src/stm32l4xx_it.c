@@ -27,29 +27,14 @@
 /*            Cortex-M4 Processor Exceptions Handlers                         */
 /******************************************************************************/
 
-extern __IO uint8_t flag__dma1_channel3_done;
-
 void DMA1_Channel3_IRQHandler(void) {
-	// This code should be executed every time the DMA is done copying the frame_buffer
-	// Test interrupt source (transfer complete)
-	if ((DMA1->ISR & DMA_ISR_TCIF3) == DMA_ISR_TCIF3) {
-		// Clear interrupt bit
-		DMA1->IFCR |= DMA_IFCR_CTCIF3;
-
-		// wait while SPI1 BSY flag is set
-		while((SPI1->SR & SPI_SR_BSY) == SPI_SR_BSY);
-
-		// Set CS high
-		GPIOA->ODR |= GPIO_ODR_OD4;
-
-		// Disable SPI1 TX DMA requests
-		SPI1->CR2 &= ~SPI_CR2_TXDMAEN;
-
-		// Disable DMA1 Channel 3
-		DMA1_Channel3->CCR &= ~DMA_CCR_EN;
+	// Transfer complete of the current display transaction, chains into the next queued one
+	ST7735_DMA_IRQHandler();
+}
 
-		flag__dma1_channel3_done = 1;
-	}
+void EXTI9_5_IRQHandler(void) {
+	// TE edge (PA8), starts the transaction waiting for the vertical blanking
+	ST7735_TE_IRQHandler();
 }
 
 /**
@@ -0,0 +1,149 @@
+import sys
+import os
+
+SOURCE_FILE_RPATH = "../app/src/"
+# space advance of proportional fonts, in pixels
+SPACE_ADVANCE = 3
+# characters that keep the full cell width in proportional fonts, so that numeric readouts don't shift
+TABULAR = "0123456789"
+
+HELP = "usage : python font_gen.py [options]\n" \
+        "with options being :\n" \
+        "\t-i <path> : text font source (see font_5x7.txt)\n" \
+        "\t-p : proportional font, empty columns on the glyph sides are trimmed (digits keep the cell width)\n" \
+        "\t-g <rows> : blank rows below the glyphs, part of the line height (default 1)\n" \
+        "\t--help : display this help message\n"
+
+
+def read_font(path: str) -> tuple:
+    # cell size and glyph rows by character code
+    width = height = 0
+    glyphs = {}
+    code = None
+    with open(path) as tfile:
+        for line in tfile:
+            line = line.strip()
+            if not line or line.startswith("#") and code is None:
+                continue
+            if line.startswith("size"):
+                width, height = (int(v) for v in line.split()[1:3])
+            elif line.startswith("0x"):
+                code = int(line, 16)
+                glyphs[code] = []
+            else:
+                glyphs[code].append([c == "#" for c in line[:width].ljust(width, ".")])
+                if len(glyphs[code]) == height:
+                    code = None
+    return width, height, glyphs
+
+
+def trim(rows: list, width: int) -> tuple:
+    # first used column and used width
+    used = [x for x in range(width) if any(row[x] for row in rows)]
+    if not used:
+        return 0, 0
+    return used[0], used[-1] - used[0] + 1
+
+
+def pack_row(row: list) -> list:
+    # MSB first, each row starts on a byte
+    out = []
+    for k in range(0, max(len(row), 1), 8):
+        bits = row[k:k + 8]
+        out.append(sum(1 << (7 - i) for i, bit in enumerate(bits) if bit))
+    return out
+
+
+def parse_sysargs() -> tuple:
+    FONT_FILE_NAME = ""
+    PROPORTIONAL = False
+    GAP = 1
+    argc = len(sys.argv)
+    if argc == 1:
+        print("No arguments specified")
+        print(HELP)
+        sys.exit(0)
+
+    for i in range(1, argc):
+        # Show help
+        if sys.argv[i] == "--help":
+            print(HELP)
+            exit(0)
+
+        # Specify font path
+        if sys.argv[i] == "-i" and i < argc - 1:
+            FONT_FILE_NAME = sys.argv[i + 1]
+
+        # Proportional font
+        if sys.argv[i] == "-p":
+            PROPORTIONAL = True
+
+        # Specify line gap
+        if sys.argv[i] == "-g" and i < argc - 1:
+            GAP = int(sys.argv[i + 1])
+
+    return FONT_FILE_NAME, PROPORTIONAL, GAP
+
+
+def main() -> None:
+    FONT_FILE_NAME, PROPORTIONAL, GAP = parse_sysargs()
+
+    print(f"Font file : {FONT_FILE_NAME}")
+    width, height, glyphs = read_font(FONT_FILE_NAME)
+    first, last = min(glyphs), max(glyphs)
+    print(f"Cell : {width}x{height}, characters 0x{first:02x} to 0x{last:02x}")
+
+    name = os.path.basename(FONT_FILE_NAME).split('.')[0].lower() + ("p" if PROPORTIONAL else "")
+    blank = [[False] * width for _ in range(height)]
+
+    bitmap = []
+    metrics = []
+    for code in range(first, last + 1):
+        rows = glyphs.get(code, blank)
+        left, used = 0, width
+        if PROPORTIONAL and chr(code) not in TABULAR:
+            left, used = trim(rows, width)
+        rows = [row[left:left + used] for row in rows]
+        # one column of spacing after each glyph
+        advance = used + 1 if used else SPACE_ADVANCE
+        metrics.append((len(bitmap), used, advance, code))
+        for row in rows:
+            bitmap += pack_row(row) if used else []
+
+    file_name = f"{name}.c"
+    with open(SOURCE_FILE_RPATH + file_name, "w") as cfile:
+        cfile.write(f"/*\n * {file_name}\n *\n *  Generated by font_gen.py, do not edit\n */\n\n")
+        cfile.write("#include \"font.h\"\n\n")
+
+        cfile.write(f"static const uint8_t {name}_bitmap[] = {{\n")
+        for offset, used, advance, code in metrics:
+            size = height * ((used + 7) // 8)
+            if size == 0:
+                continue
+            row_bytes = ", ".join(f"0x{b:02x}" for b in bitmap[offset:offset + size])
+            cfile.write(f"\t{row_bytes}, // {chr(code)!r}\n")
+        cfile.write("};\n\n")
+
+        if PROPORTIONAL:
+            cfile.write(f"static const struct FONT_Glyph {name}_glyphs[] = {{\n")
+            for offset, used, advance, code in metrics:
+                cfile.write(f"\t\t{{ {offset}, {used}, {advance} }}, // {chr(code)!r}\n")
+            cfile.write("};\n\n")
+
+        cfile.write(f"const struct FONT_Font {name} = {{\n")
+        cfile.write(f"\t\t.bitmap = {name}_bitmap,\n")
+        cfile.write(f"\t\t.glyphs = {name + '_glyphs' if PROPORTIONAL else '0'},\n")
+        cfile.write(f"\t\t.first = 0x{first:02x},\n")
+        cfile.write(f"\t\t.last = 0x{last:02x},\n")
+        cfile.write(f"\t\t.width = {width},\n")
+        cfile.write(f"\t\t.advance = {width + 1},\n")
+        cfile.write(f"\t\t.rows = {height},\n")
+        cfile.write(f"\t\t.height = {height + GAP},\n")
+        cfile.write("};\n")
+
+    print(f"Bitmap size : {len(bitmap)} bytes")
+    print(f"Font written to {SOURCE_FILE_RPATH + file_name}")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,12 +1,48 @@
 import sys
 import os
+import re
+import struct
 from PIL import Image
 from numpy import asarray
 
 SOURCE_FILE_RPATH = "../app/data/"
-SOURCE_FILE_NAME = None
+ASSET_SOURCE_RPATH = "../app/src/"
+REGISTRY_HEADER = "assets.h"
+REGISTRY_SOURCE = "assets.c"
+# first line of each generated asset source : name, width, height
+ASSET_MARKER = "// asset : "
+# payload alignment in the .assets section (see STM32L476RGTX_FLASH.ld)
+ASSET_ALIGN = 16
+# asset pack (-b), flashed at the start of the PACK region (see asset_pack.h)
+PACK_FILE_NAME = "assets.pack"
+PACK_MAGIC = 0x4B505453 # "STPK"
+PACK_VERSION = 1
+PACK_ALIGN = 16
+# header : magic, version, count, directory offset, total size
+PACK_HEADER = struct.Struct("<IHHII")
+# directory entry : hash, offset, size, width, height, format, encoding, palette offset, colors, bpp, reserved
+PACK_ENTRY = struct.Struct("<IIIBBBBIHBB")
+# enum PIXEL_FORMAT and enum IMG_ENCODING values
+PACK_FORMATS = {"PIXEL_FORMAT_444": 0x03, "PIXEL_FORMAT_565": 0x05, "PIXEL_FORMAT_666": 0x06}
+PACK_ENCODINGS = {"IMG_ENCODING_RAW": 0, "IMG_ENCODING_RLE": 1, "IMG_ENCODING_QOI": 2, "IMG_ENCODING_INDEXED": 3}
 PIXEL_MAX_WIDTH = 128
 PIXEL_MAX_HEIGHT = 160
+PIXEL_FORMATS = ("444", "565", "666")
+ENCODINGS = ("raw", "rle", "qoi")
+
+# RLE : control byte, 1CCCCCCC => C + 1 copies of the next pixel, 0CCCCCCC => C + 1 literal pixels
+RLE_MAX_COUNT = 128
+
+# QOI-style ops, on the components of the selected format
+QOI_OP_INDEX = 0x00 # 00xxxxxx : index in the table of recently seen pixels
+QOI_OP_DIFF = 0x40  # 01rrggbb : component differences in [-2, 1]
+QOI_OP_LUMA = 0x80  # 10gggggg rrrrbbbb : green difference in [-32, 31], red / blue in [-8, 7] relative to it
+QOI_OP_RUN = 0xC0   # 11xxxxxx : previous pixel repeated x + 1 times (1 to 62)
+QOI_OP_COLOR = 0xFE # full pixel follows
+QOI_RUN_MAX = 62
+
+# Palette sizes for indexed images and the matching bits per pixel
+PALETTE_BPP = {2: 1, 4: 2, 16: 4, 256: 8}
 
 HELP = "usage : python frame_gen.py [options]\n" \
         "with options being :\n" \
@@ -14,6 +50,9 @@ HELP = "usage : python frame_gen.py [options]\n" \
         "\t-h <frame height> : set frame height in pixel (default 160) \n" \
         "\t-i <path> : fill frame with data from image located at <path>\n" \
         "\t-f <format> : set RGB format(for example 444, 565 or 666)\n"\
+        "\t-c <encoding> : raw (default), rle or qoi (lossless, decoded by image.c)\n"\
+        "\t-p <colors> : quantize to a palette of 2, 4, 16 or 256 colors (1, 2, 4 or 8 bpp indices)\n"\
+        "\t-b : add the image to the asset pack ./app/data/assets.pack instead of generating C sources\n"\
         "\t--help : display this help message\n"
 
 def is_supported(width_height: str, size: int) -> bool:
@@ -22,12 +61,161 @@ def is_supported(width_height: str, size: int) -> bool:
     elif width_height == "height":
         return size > 0 and size <= PIXEL_MAX_HEIGHT
     return False
-    
+
+
+def encode_666(rgb) -> list:
+    # map color to RGB-666, one byte per component (6 MSBs used)
+    red = int(int(rgb[0]) * 0xFC / 0xFF)
+    green = int(int(rgb[1]) * 0xFC / 0xFF)
+    blue = int(int(rgb[2]) * 0xFC / 0xFF)
+    return [f"0x{red:02x}", f"0x{green:02x}", f"0x{blue:02x}"]
+
+
+def encode_565(rgb) -> list:
+    # map color to RGB-565, one 16 bit word per pixel (sent as a single 16 bit SPI frame)
+    red = int(int(rgb[0]) * 0x1F / 0xFF)
+    green = int(int(rgb[1]) * 0x3F / 0xFF)
+    blue = int(int(rgb[2]) * 0x1F / 0xFF)
+    return [f"0x{(red << 11) | (green << 5) | blue:04x}"]
+
+
+def pack_444(pixels: list) -> list:
+    # map colors to RGB-444 and pack each pair of pixels into 3 bytes : R0G0 B0R1 G1B1
+    # an odd last pixel takes 2 bytes : R0G0 B0(pad)
+    nibbles = []
+    for rgb in pixels:
+        nibbles += [int(int(c) * 0x0F / 0xFF) for c in rgb[:3]]
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [f"0x{(nibbles[k] << 4) | nibbles[k + 1]:02x}" for k in range(0, len(nibbles), 2)]
+
+
+# Component widths of each format, red first
+COMPONENT_BITS = {"444": (4, 4, 4), "565": (5, 6, 5), "666": (6, 6, 6)}
+
+
+def to_components(rgb, pixel_format: str) -> tuple:
+    # same quantization as the raw encoders (6-6-6 keeps the 6 MSBs of each byte sent)
+    if pixel_format == "666":
+        return tuple(int(int(c) * 0xFC / 0xFF) >> 2 for c in rgb[:3])
+    return tuple(int(int(c) * ((1 << bits) - 1) / 0xFF) for c, bits in zip(rgb[:3], COMPONENT_BITS[pixel_format]))
+
+
+def color_bytes(components: tuple, pixel_format: str) -> list:
+    # pixel as the driver color value (RED_xxx, ...), MSB first : 3 bytes in 6-6-6, 2 bytes otherwise
+    color = 0
+    for c, bits in zip(components, COMPONENT_BITS[pixel_format]):
+        color = (color << bits) | c
+    if pixel_format == "666":
+        return [color >> 16, (color >> 8) & 0xFF, color & 0xFF]
+    return [color >> 8, color & 0xFF]
+
+
+def encode_rle(pixels: list, pixel_format: str) -> list:
+    out = []
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:RLE_MAX_COUNT]
+            del literals[:RLE_MAX_COUNT]
+            out.append(len(chunk) - 1)
+            for px in chunk:
+                out.extend(color_bytes(px, pixel_format))
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < RLE_MAX_COUNT and pixels[i + run] == pixels[i]:
+            run += 1
+        # runs of 2 pixels cost as much as literals in 5-6-5 / 4-4-4, keep them as runs anyway
+        if run >= 2:
+            flush_literals()
+            out.append(0x80 | (run - 1))
+            out.extend(color_bytes(pixels[i], pixel_format))
+        else:
+            literals.append(pixels[i])
+        i += run
+    flush_literals()
+    return out
+
+
+def qoi_hash(px: tuple) -> int:
+    return (px[0] * 3 + px[1] * 5 + px[2] * 7) % 64
+
+
+def encode_qoi(pixels: list, pixel_format: str) -> list:
+    # differences wrap around the component range, the decoder masks them the same way
+    sizes = [1 << bits for bits in COMPONENT_BITS[pixel_format]]
+
+    def wrap(d, size):
+        d %= size
+        return d - size if d >= size // 2 else d
+
+    out = []
+    index = [(0, 0, 0)] * 64
+    previous = (0, 0, 0)
+    run = 0
+
+    for px in pixels:
+        if px == previous:
+            run += 1
+            if run == QOI_RUN_MAX:
+                out.append(QOI_OP_RUN | (run - 1))
+                run = 0
+            continue
+
+        if run:
+            out.append(QOI_OP_RUN | (run - 1))
+            run = 0
+
+        h = qoi_hash(px)
+        if index[h] == px:
+            out.append(QOI_OP_INDEX | h)
+        else:
+            index[h] = px
+            dr, dg, db = (wrap(c - p, size) for c, p, size in zip(px, previous, sizes))
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(QOI_OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out.append(QOI_OP_LUMA | (dg + 32))
+                out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+            else:
+                out.append(QOI_OP_COLOR)
+                out.extend(color_bytes(px, pixel_format))
+        previous = px
+
+    if run:
+        out.append(QOI_OP_RUN | (run - 1))
+    return out
+
+
+def pack_indices(indices: list, bpp: int) -> list:
+    # MSB first, each row starts on a byte
+    out = []
+    for row in indices:
+        bits = 0
+        count = 0
+        for index in row:
+            bits = (bits << bpp) | int(index)
+            count += bpp
+            if count == 8:
+                out.append(bits)
+                bits = 0
+                count = 0
+        if count:
+            out.append(bits << (8 - count))
+    return out
+
 
 def parse_sysargs() -> tuple:
     IMG_FILE_NAME = ""
     PIXEL_WIDTH = PIXEL_MAX_WIDTH
     PIXEL_HEIGHT = PIXEL_MAX_HEIGHT
+    PIXEL_FORMAT = "666"
+    ENCODING = "raw"
+    COLORS = 0
+    PACK = False
     argc = len(sys.argv)
     if argc == 1:
         print("No arguments specified")
@@ -59,12 +247,37 @@ def parse_sysargs() -> tuple:
         # Specify image path
         if sys.argv[i] == "-i" and i < argc - 1:
             IMG_FILE_NAME = sys.argv[i + 1]
+
+        # Specify RGB format
+        if sys.argv[i] == "-f" and i < argc - 1:
+            if sys.argv[i + 1] in PIXEL_FORMATS:
+                PIXEL_FORMAT = sys.argv[i + 1]
+            else:
+                print(f"Format not supported, defaulting to {PIXEL_FORMAT}")
+
+        # Specify encoding
+        if sys.argv[i] == "-c" and i < argc - 1:
+            if sys.argv[i + 1] in ENCODINGS:
+                ENCODING = sys.argv[i + 1]
+            else:
+                print(f"Encoding not supported, defaulting to {ENCODING}")
+
+        # Specify palette size (indexed image)
+        if sys.argv[i] == "-p" and i < argc - 1:
+            if int(sys.argv[i + 1]) in PALETTE_BPP:
+                COLORS = int(sys.argv[i + 1])
+            else:
+                print("Palette size not supported, image is not indexed")
+
+        # Write to the asset pack
+        if sys.argv[i] == "-b":
+            PACK = True
             
-    return IMG_FILE_NAME, PIXEL_WIDTH, PIXEL_HEIGHT
+    return IMG_FILE_NAME, PIXEL_WIDTH, PIXEL_HEIGHT, PIXEL_FORMAT, ENCODING, COLORS, PACK
                 
 
 def main() -> None:
-    IMG_FILE_NAME, PIXEL_WIDTH, PIXEL_HEIGHT = parse_sysargs()
+    IMG_FILE_NAME, PIXEL_WIDTH, PIXEL_HEIGHT, PIXEL_FORMAT, ENCODING, COLORS, PACK = parse_sysargs()
     
     # Get image data
     print(f"Image file : {IMG_FILE_NAME}")
@@ -74,40 +287,229 @@ def main() -> None:
     
     img_res_data = asarray(img_res)
     print(img_res_data.shape)
+    print(f"RGB format : {PIXEL_FORMAT}")
+    print(f"Encoding : {ENCODING}")
     
-    img_name_only = os.path.basename(IMG_FILE_NAME).split('.')[0]
-    
-    HEADER_FILE_NAME = img_name_only.lower() + "_frame.h"
-    BUFFER_NAME = img_name_only.lower() + "_buffer"
-    
-    def_width = img_name_only.upper() + "_WIDTH"
-    def_height = img_name_only.upper() + "_HEIGHT"
-    
-    with open(SOURCE_FILE_RPATH + HEADER_FILE_NAME, "w") as hfile:
-        def1 = HEADER_FILE_NAME.upper().replace(".", "_")
-        hfile.write(f"#ifndef {def1}\n")
-        hfile.write(f"#define {def1}\n\n")
-        
-        hfile.write(f"#define {def_width} {PIXEL_WIDTH}\n")
-        hfile.write(f"#define {def_height} {PIXEL_HEIGHT}\n\n")
-        
-        hfile.write("typedef unsigned char uint8_t;\n\n")
-        
-        hfile.write(f"static const uint8_t {BUFFER_NAME}[{def_width} * {def_height} * 3] = {{\n")
-        
-        for i in range(PIXEL_HEIGHT):
-            hfile.write("\t")
-            for j in range(PIXEL_WIDTH):
-                # map color to RGB-666 and write to file
-                red = int(img_res_data[i][j][0] * 0xFC / 0xFF)
-                green = int(img_res_data[i][j][1] * 0xFC / 0xFF)
-                blue = int(img_res_data[i][j][2] * 0xFC / 0xFF)
-                hfile.write(f"0x{red:02x}, 0x{green:02x}, 0x{blue:02x},   ")
-            hfile.write("\n")
-            
-        hfile.write("};\n\n")
+    img_name_only = os.path.basename(IMG_FILE_NAME).split('.')[0].lower()
+
+    # descriptor fields, payload type and array lines
+    asset = {
+        "name": img_name_only,
+        "width": PIXEL_WIDTH,
+        "height": PIXEL_HEIGHT,
+        "format": f"PIXEL_FORMAT_{PIXEL_FORMAT}",
+        "encoding": f"IMG_ENCODING_{ENCODING.upper()}",
+        "type": "uint8_t",
+        "palette": None,
+    }
+
+    if COLORS:
+        # palette indices, expanded through a LUT on the target (see image.c), independent of the RGB format
+        bpp = PALETTE_BPP[COLORS]
+        quantized = img_res.convert("RGB").quantize(colors=COLORS)
+        palette = quantized.getpalette()[:COLORS * 3]
+        palette += [0] * (COLORS * 3 - len(palette))
+        packed = [f"0x{b:02x}" for b in pack_indices(asarray(quantized), bpp)]
+        print(f"Indexed size : {len(packed)} bytes + {COLORS} colors palette ({bpp} bpp)")
+        asset["encoding"] = "IMG_ENCODING_INDEXED"
+        asset["bpp"] = bpp
+        # RGB 8-8-8
+        colors = [f"0x{palette[k]:02x}{palette[k + 1]:02x}{palette[k + 2]:02x}" for k in range(0, len(palette), 3)]
+        asset["palette"] = [", ".join(colors[k:k + 8]) + "," for k in range(0, len(colors), 8)]
+        # one line of the array per row of pixels
+        step = (PIXEL_WIDTH * bpp + 7) // 8
+        lines = [", ".join(packed[k:k + step]) + "," for k in range(0, len(packed), step)]
+    elif ENCODING != "raw":
+        # compressed stream, decoded line by line on the target (see image.c)
+        pixels = [to_components(img_res_data[i][j], PIXEL_FORMAT) for i in range(PIXEL_HEIGHT) for j in range(PIXEL_WIDTH)]
+        encode = encode_rle if ENCODING == "rle" else encode_qoi
+        stream = [f"0x{b:02x}" for b in encode(pixels, PIXEL_FORMAT)]
+        print(f"Compressed size : {len(stream)} bytes")
+        step = 32
+        lines = [", ".join(stream[k:k + step]) + "," for k in range(0, len(stream), step)]
+    elif PIXEL_FORMAT == "444":
+        # 3 bytes per pair of pixels, packed over the whole frame since RAMWR is one continuous stream
+        packed = pack_444([img_res_data[i][j] for i in range(PIXEL_HEIGHT) for j in range(PIXEL_WIDTH)])
+        # one line of the array per 2 rows of pixels
+        step = PIXEL_WIDTH * 3
+        lines = [", ".join(packed[k:k + step]) + "," for k in range(0, len(packed), step)]
+    else:
+        if PIXEL_FORMAT == "565":
+            # 2 bytes per pixel, stored as half-words for 16 bit SPI / DMA transfers
+            asset["type"] = "uint16_t"
+            encode = encode_565
+        else:
+            # 3 bytes per pixel
+            encode = encode_666
+        # map color to the selected format, one line of the array per row of pixels
+        lines = ["".join(", ".join(encode(img_res_data[i][j])) + ",   " for j in range(PIXEL_WIDTH))
+                 for i in range(PIXEL_HEIGHT)]
+
+    if PACK:
+        write_pack(asset, lines)
+    else:
+        write_asset_source(asset, lines)
+        write_registry()
+
+
+def write_asset_source(asset: dict, lines: list) -> None:
+    # one translation unit per asset : a single copy in flash, in the .assets section
+    name = asset["name"]
+    file_name = f"{name}_asset.c"
+
+    with open(ASSET_SOURCE_RPATH + file_name, "w") as cfile:
+        cfile.write(f"/*\n * {file_name}\n *\n *  Generated by frame_gen.py, do not edit\n */\n")
+        cfile.write(f"{ASSET_MARKER}{name} {asset['width']} {asset['height']}\n\n")
+        cfile.write(f"#include \"{REGISTRY_HEADER}\"\n\n")
+
+        if asset["palette"]:
+            cfile.write(f"static const uint32_t {name}_palette[] __attribute__((section(\".assets\"), aligned(ASSET_ALIGN))) = {{\n")
+            for line in asset["palette"]:
+                cfile.write("\t" + line + "\n")
+            cfile.write("};\n\n")
+
+        cfile.write(f"static const {asset['type']} {name}_data[] __attribute__((section(\".assets\"), aligned(ASSET_ALIGN))) = {{\n")
+        for line in lines:
+            cfile.write("\t" + line.rstrip() + "\n")
+        cfile.write("};\n\n")
+
+        cfile.write(f"const struct IMG_Image {name}_asset = {{\n")
+        cfile.write(f"\t\t.name = \"{name}\",\n")
+        cfile.write(f"\t\t.data = (const uint8_t*){name}_data,\n")
+        cfile.write(f"\t\t.size = sizeof({name}_data),\n")
+        cfile.write(f"\t\t.width = {asset['width']},\n")
+        cfile.write(f"\t\t.height = {asset['height']},\n")
+        cfile.write(f"\t\t.encoding = {asset['encoding']},\n")
+        cfile.write(f"\t\t.format = {asset['format']},\n")
+        if asset["palette"]:
+            cfile.write(f"\t\t.palette = {name}_palette,\n")
+            cfile.write(f"\t\t.colors = sizeof({name}_palette) / sizeof({name}_palette[0]),\n")
+            cfile.write(f"\t\t.bpp = {asset['bpp']},\n")
+        cfile.write("};\n")
+
+    print(f"Asset written to {ASSET_SOURCE_RPATH + file_name}")
+
+
+def write_registry() -> None:
+    # asset table rebuilt from every generated *_asset.c, IDs follow the alphabetical order of the names
+    assets = []
+    for file_name in sorted(os.listdir(ASSET_SOURCE_RPATH)):
+        if not file_name.endswith("_asset.c"):
+            continue
+        with open(ASSET_SOURCE_RPATH + file_name) as cfile:
+            for line in cfile:
+                if line.startswith(ASSET_MARKER):
+                    name, width, height = line[len(ASSET_MARKER):].split()
+                    assets.append((name, int(width), int(height)))
+                    break
+
+    with open(SOURCE_FILE_RPATH + REGISTRY_HEADER, "w") as hfile:
+        hfile.write(f"/*\n * {REGISTRY_HEADER}\n *\n *  Generated by frame_gen.py, do not edit\n */\n\n")
+        hfile.write("#ifndef APP_DATA_ASSETS_H_\n#define APP_DATA_ASSETS_H_\n\n")
+        hfile.write("#include \"image.h\"\n\n")
+        hfile.write("// Alignment of the asset payloads in the .assets section\n")
+        hfile.write(f"#define ASSET_ALIGN {ASSET_ALIGN}\n\n")
+        for name, width, height in assets:
+            hfile.write(f"#define {name.upper()}_WIDTH {width}\n")
+            hfile.write(f"#define {name.upper()}_HEIGHT {height}\n")
+        hfile.write("\n// Index in the asset table\n")
+        hfile.write("enum ASSET_ID {\n")
+        for name, _, _ in assets:
+            hfile.write(f"\tASSET_{name.upper()},\n")
+        hfile.write("\tASSET_COUNT,\n};\n\n")
+        for name, _, _ in assets:
+            hfile.write(f"extern const struct IMG_Image {name}_asset;\n")
+        hfile.write("\n")
+        hfile.write("const struct IMG_Image* ASSET_Get(const enum ASSET_ID id);\n\n")
+        hfile.write("#endif /* APP_DATA_ASSETS_H_ */\n")
+
+    with open(ASSET_SOURCE_RPATH + REGISTRY_SOURCE, "w") as cfile:
+        cfile.write(f"/*\n * {REGISTRY_SOURCE}\n *\n *  Generated by frame_gen.py, do not edit\n */\n\n")
+        cfile.write(f"#include \"{REGISTRY_HEADER}\"\n\n")
+        cfile.write("static const struct IMG_Image* const asset_table[ASSET_COUNT] = {\n")
+        for name, _, _ in assets:
+            cfile.write(f"\t\t[ASSET_{name.upper()}] = &{name}_asset,\n")
+        cfile.write("};\n\n")
+        cfile.write("const struct IMG_Image* ASSET_Get(const enum ASSET_ID id) {\n")
+        cfile.write("\tif (id >= ASSET_COUNT) return 0;\n")
+        cfile.write("\treturn asset_table[id];\n}\n")
+
+    print(f"Asset table : {', '.join(name for name, _, _ in assets)}")
+
+def pack_hash(name: str) -> int:
+    # FNV-1a, same as PACK_Hash (asset_pack.c)
+    h = 0x811C9DC5
+    for c in name.encode():
+        h = ((h ^ c) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def pack_align(blob: bytearray) -> None:
+    blob += bytes(-len(blob) % PACK_ALIGN)
+
+
+def read_pack(path: str) -> dict:
+    # entries of an existing pack, by hash : (directory fields, payload, palette)
+    entries = {}
+    if not os.path.exists(path):
+        return entries
+    with open(path, "rb") as pfile:
+        blob = pfile.read()
+    magic, version, count, directory, _ = PACK_HEADER.unpack_from(blob, 0)
+    if magic != PACK_MAGIC or version != PACK_VERSION:
+        print(f"{path} is not a version {PACK_VERSION} asset pack, starting a new one")
+        return entries
+    for k in range(count):
+        h, offset, size, width, height, fmt, enc, palette, colors, bpp, _ = \
+            PACK_ENTRY.unpack_from(blob, directory + k * PACK_ENTRY.size)
+        entries[h] = ((width, height, fmt, enc, colors, bpp), blob[offset:offset + size],
+                      blob[palette:palette + colors * 4] if palette else b"")
+    return entries
+
+
+def write_pack(asset: dict, lines: list) -> None:
+    # the payload is the same data as the C array, half-words stored little endian like in flash
+    values = [int(v, 16) for line in lines for v in re.findall(r"0x[0-9a-fA-F]+", line)]
+    payload = struct.pack(f"<{len(values)}{'H' if asset['type'] == 'uint16_t' else 'B'}", *values)
+    palette = b""
+    if asset["palette"]:
+        colors = [int(v, 16) for line in asset["palette"] for v in re.findall(r"0x[0-9a-fA-F]+", line)]
+        palette = struct.pack(f"<{len(colors)}I", *colors)
+
+    path = SOURCE_FILE_RPATH + PACK_FILE_NAME
+    entries = read_pack(path)
+    h = pack_hash(asset["name"])
+    # an asset with the same name is replaced
+    entries[h] = ((asset["width"], asset["height"], PACK_FORMATS[asset["format"]], PACK_ENCODINGS[asset["encoding"]],
+                   len(palette) // 4, asset.get("bpp", 0)), payload, palette)
+
+    # header, directory sorted by hash (binary search on the target), then aligned payloads
+    hashes = sorted(entries)
+    blob = bytearray(PACK_HEADER.size + len(hashes) * PACK_ENTRY.size)
+    pack_align(blob)
+    directory = []
+    for k in hashes:
+        fields, data, colors = entries[k]
+        palette_offset = 0
+        if colors:
+            palette_offset = len(blob)
+            blob += colors
+            pack_align(blob)
+        offset = len(blob)
+        blob += data
+        pack_align(blob)
+        width, height, fmt, enc, count, bpp = fields
+        directory.append(PACK_ENTRY.pack(k, offset, len(data), width, height, fmt, enc, palette_offset, count, bpp, 0))
+
+    PACK_HEADER.pack_into(blob, 0, PACK_MAGIC, PACK_VERSION, len(hashes), PACK_HEADER.size, len(blob))
+    blob[PACK_HEADER.size:PACK_HEADER.size + len(hashes) * PACK_ENTRY.size] = b"".join(directory)
+
+    with open(path, "wb") as pfile:
+        pfile.write(blob)
+
+    print(f"Asset ID : 0x{h:08x} (PACK_Hash(\"{asset['name']}\"))")
+    print(f"Asset pack written to {path} : {len(hashes)} assets, {len(blob)} bytes")
 
-        hfile.write("#endif")
 
 if __name__ == "__main__":
     main()
\ No newline at end of file